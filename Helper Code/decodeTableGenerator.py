@@ -0,0 +1,222 @@
+# Generates XtensaLX_decodeTables.h from xtensa_core.isa
+#
+# usage: python3 decodeTableGenerator.py [description] [output]
+# run from this folder with no arguments to regenerate the header next to XtensaLX.h
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_DESCRIPTION = os.path.join(HERE, "xtensa_core.isa")
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "XtensaLX_decodeTables.h")
+
+PRIMARY_FIELDS = ["op0", "op1", "op2", "r"]
+SECONDARY_FIELDS = ["s", "t", "m", "n"]
+SECONDARY_FLAG = 0x80  # must match XTEN_DECODE_SECONDARY
+ILLEGAL = "ILLEGAL"
+
+
+def parse_value(text, line_number):
+    try:
+        if "-" in text:
+            low, high = text.split("-")
+            values = set(range(int(low, 16), int(high, 16) + 1))
+        else:
+            values = {int(text, 16)}
+    except ValueError:
+        sys.exit("line %d: bad value %s" % (line_number, text))
+    return values
+
+
+def parse(path):
+    families = []
+    instructions = []
+    with open(path) as description:
+        for line_number, line in enumerate(description, 1):
+            words = line.split("#")[0].split()
+            if not words:
+                continue
+            if words[0] == "family":
+                if len(words) != 3:
+                    sys.exit("line %d: family needs a name and a handler" % line_number)
+                families.append((words[1], words[2]))
+                continue
+            if len(words) < 2:
+                sys.exit("line %d: instruction needs a family" % line_number)
+            fields = {}
+            handler = None
+            for word in words[2:]:
+                name, _, value = word.partition("=")
+                if name == "handler":
+                    handler = value
+                    continue
+                if name not in PRIMARY_FIELDS + SECONDARY_FIELDS:
+                    sys.exit("line %d: unknown field %s" % (line_number, name))
+                fields[name] = parse_value(value, line_number)
+            instructions.append((words[0], words[1], fields, line_number, handler))
+    names = [family[0] for family in families]
+    if not names or names[0] != "illegal":
+        sys.exit("the first family must be illegal")
+    for mnemonic, family, fields, line_number, _ in instructions:
+        if family not in names:
+            sys.exit("line %d: unknown family %s" % (line_number, family))
+    return families, instructions
+
+
+def selector(fields):
+    used = [name for name in SECONDARY_FIELDS if name in fields]
+    if not used:
+        return None
+    if used == ["s"]:
+        return "S"
+    if used == ["t"]:
+        return "T"
+    if set(used) <= {"m", "n"}:
+        return "MN"
+    return "MIXED"
+
+
+def secondary_values(select, key):
+    # key is the index into a secondary table MN tables are indexed by m << 2 | n
+    if select == "S":
+        return {"s": key}
+    if select == "T":
+        return {"t": key}
+    return {"m": key >> 2, "n": key & 3}
+
+
+def matches(fields, values):
+    return all(values[name] in allowed for name, allowed in fields.items() if name in values)
+
+
+def build(families, instructions):
+    ops = [(ILLEGAL, "illegal", None)] + [(mnemonic, family, handler) for mnemonic, family, _, _, handler in instructions]
+    primary = []
+    secondaries = []
+    selects = []
+    for index in range(1 << 16):
+        values = {"op0": index & 0xF, "op1": (index >> 4) & 0xF, "op2": (index >> 8) & 0xF, "r": index >> 12}
+        candidates = [(op, fields) for op, (_, _, fields, _, _) in enumerate(instructions, 1) if matches(fields, values)]
+        kinds = {selector(fields) for _, fields in candidates} - {None}
+        if len(kinds) > 1 or "MIXED" in kinds:
+            lines = ", ".join(str(instructions[op - 1][3]) for op, _ in candidates)
+            sys.exit("lines %s: instructions sharing op0 op1 op2 and r must pick between them with one of s t or m and n" % lines)
+        if not kinds:
+            primary.append(candidates[0][0] if candidates else 0)
+            continue
+        select = kinds.pop()
+        table = []
+        for key in range(16):
+            keyed = dict(values, **secondary_values(select, key))
+            table.append(next((op for op, fields in candidates if matches(fields, keyed)), 0))
+        if len(set(table)) == 1:
+            primary.append(table[0])
+            continue
+        if (select, table) not in zip(selects, secondaries):
+            secondaries.append(table)
+            selects.append(select)
+        secondary = list(zip(selects, secondaries)).index((select, table))
+        primary.append(SECONDARY_FLAG | secondary)
+    if len(ops) > SECONDARY_FLAG or len(secondaries) > SECONDARY_FLAG:
+        sys.exit("too many instructions or secondary tables for one byte entries")
+    return ops, primary, secondaries, selects
+
+
+def family_constant(name):
+    return "XTEN_FAMILY_" + re.sub(r"([a-z])([A-Z])", r"\1_\2", name).upper()
+
+
+def write(path, families, ops, primary, secondaries, selects):
+    handlers = dict(families)
+    names = [family[0] for family in families]
+    out = []
+    out.append("// Generated by Helper Code/decodeTableGenerator.py from Helper Code/xtensa_core.isa do not edit by hand")
+    out.append("// Included by XtensaLX.h after the handler prototypes")
+    out.append("")
+    out.append("#ifndef XTENSA_LX_DECODE_TABLES_H")
+    out.append("#define XTENSA_LX_DECODE_TABLES_H")
+    out.append("")
+    out.append("/*decoded instructions*/")
+    out.append("enum")
+    out.append("{")
+    for number, (mnemonic, _, _) in enumerate(ops):
+        out.append("    XTEN_OP_%s = %d," % (mnemonic.replace(".", "_"), number))
+    out.append("    XTEN_OP_COUNT = %d" % len(ops))
+    out.append("};")
+    out.append("")
+    out.append("/*which byte order independent fields pick the entry in a secondary table*/")
+    out.append("#define XTEN_SELECT_S 0  // indexed by s")
+    out.append("#define XTEN_SELECT_T 1  // indexed by t")
+    out.append("#define XTEN_SELECT_MN 2 // indexed by m << 2 | n")
+    out.append("#define XTEN_DECODE_SECONDARY_COUNT %d" % max(len(secondaries), 1))
+    out.append("")
+    out.append("/*handlers of single instructions*/")
+    for _, _, handler in ops:
+        if handler is not None:
+            out.append("static inline void %s(Xtensa_lx_CPU *CPU, uint32_t opcode);" % handler)
+    out.append("")
+    out.append("// X(name, handler) for every instruction in XTEN_OP_* order")
+    out.append("#define XTEN_FOR_EACH_OP(X) \\")
+    for number, (mnemonic, family, handler) in enumerate(ops):
+        out.append("    X(%s, %s)%s" % (mnemonic.replace(".", "_"), handler or handlers[family], " \\" if number + 1 < len(ops) else ""))
+    out.append("")
+    out.append("static const char *const xten_opNames[XTEN_OP_COUNT] = {")
+    for mnemonic, _, _ in ops:
+        out.append("    \"%s\"," % mnemonic)
+    out.append("};")
+    out.append("")
+    out.append("static void (*const xten_opHandlers[XTEN_OP_COUNT])(Xtensa_lx_CPU *CPU, uint32_t opcode) = {")
+    for mnemonic, family, handler in ops:
+        out.append("    %s, // %s" % (handler or handlers[family], mnemonic))
+    out.append("};")
+    out.append("")
+    out.append("/*instruction families one for every handler*/")
+    out.append("enum")
+    out.append("{")
+    for number, name in enumerate(names):
+        out.append("    %s = %d," % (family_constant(name), number))
+    out.append("    XTEN_FAMILY_COUNT = %d" % len(names))
+    out.append("};")
+    out.append("")
+    out.append("static const char *const xten_familyNames[XTEN_FAMILY_COUNT] = {")
+    for name in names:
+        out.append("    \"%s\"," % name)
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t xten_opFamilies[XTEN_OP_COUNT] = {")
+    for mnemonic, family, _ in ops:
+        out.append("    %s, // %s" % (family_constant(family), mnemonic))
+    out.append("};")
+    out.append("")
+    out.append("// indexed by op0 | op1 << 4 | op2 << 8 | r << 12 entries with XTEN_DECODE_SECONDARY set name a secondary table")
+    out.append("static const uint8_t xten_decodePrimary[65536] = {")
+    for row in range(0, len(primary), 16):
+        out.append("    " + " ".join("0x%02X," % entry for entry in primary[row:row + 16]))
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t xten_decodeSelect[XTEN_DECODE_SECONDARY_COUNT] = {")
+    out.append("    " + " ".join("XTEN_SELECT_%s," % select for select in selects or ["S"]))
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t xten_decodeSecondary[XTEN_DECODE_SECONDARY_COUNT][16] = {")
+    for table in secondaries or [[0] * 16]:
+        out.append("    {" + " ".join("XTEN_OP_%s," % ops[op][0].replace(".", "_") for op in table) + "},")
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    with open(path, "w", newline="\n") as header:
+        header.write("\n".join(out) + "\n")
+
+
+def main():
+    description = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_DESCRIPTION
+    output = sys.argv[2] if len(sys.argv) > 2 else DEFAULT_OUTPUT
+    families, instructions = parse(description)
+    ops, primary, secondaries, selects = build(families, instructions)
+    write(output, families, ops, primary, secondaries, selects)
+    print("%d instructions %d secondary tables written to %s" % (len(ops), len(secondaries), output))
+
+
+if __name__ == "__main__":
+    main()
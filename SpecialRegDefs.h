@@ -53,7 +53,7 @@
 #define DBREAKC14_NUM 174
 #define DBREAKC15_NUM 175 // data break control
 
-#define DEBUGCAUSE_NUM 133 // cause of last debug exception
+#define DEBUGCAUSE_NUM 233 // cause of last debug exception
 #define DDR_NUM 104        // debug data register
 #define DEPC_NUM 192       // Double exception PC
 
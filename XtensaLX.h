@@ -1,7 +1,9 @@
 #ifndef XTENSA_LX_H
 #define XTENSA_LX_H
+#ifndef XTEN_NO_DEBUGGING // define XTEN_NO_DEBUGGING before including to stop every instruction being printed
 #define XTEN_DEBUGGING
 #define XTEN_DEBUGGING_DETAILED
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -12,6 +14,38 @@ extern "C"
 #include <stdint.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "SpecialRegDefs.h"
+
+#ifdef XTEN_ENABLE_JIT // define XTEN_ENABLE_JIT before including to translate hot code to x86-64
+#if !defined(__x86_64__) || !(defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__))
+#error "XTEN_ENABLE_JIT needs an x86-64 host with mmap"
+#endif
+#include <sys/mman.h>
+#ifndef MAP_ANONYMOUS // strict ISO C modes such as -std=c11 hide it
+#ifdef MAP_ANON
+#define MAP_ANONYMOUS MAP_ANON
+#elif defined(__linux__)
+#define MAP_ANONYMOUS 0x20 // value on Linux
+#else
+#define MAP_ANONYMOUS 0x1000 // value on macOS and FreeBSD
+#endif
+#endif
+#endif
+
+#ifdef XTEN_DEBUGGING
+#define XTEN_DEBUG_PRINT(...) printf(__VA_ARGS__)
+#else
+#define XTEN_DEBUG_PRINT(...) ((void)0)
+#endif
+
+#ifdef XTEN_ENABLE_STATS // define XTEN_ENABLE_STATS before including to count the instruction mix in CPU->stats
+#define XTEN_HELPER_COUNT_OP(CPU, op) ((CPU)->stats.ops[(op)]++)
+#else
+#define XTEN_HELPER_COUNT_OP(CPU, op) ((void)0)
+#endif
 
 /*CPU defines no magic numbers floating about*/
 #define DEFAULT_REGISTER_FILE_SIZE 32
@@ -24,6 +58,98 @@ extern "C"
 #define XTEN_HIGH 1
 #define XTEN_LOW 0
 
+/*Allocation defines every CPU lives in one block made of the CPU struct followed by an arena*/
+#define XTEN_ARENA_ALIGNMENT 16
+#define XTEN_DEFAULT_ARENA_SIZE (256 * 1024)
+#define XTEN_ALIGN_UP(value) (((size_t)(value) + XTEN_ARENA_ALIGNMENT - 1) & ~(size_t)(XTEN_ARENA_ALIGNMENT - 1))
+
+/*Memory map defines the 32 bit address space is split into 4KB pages grouped into 4MB page tables*/
+#define XTEN_PAGE_SHIFT 12
+#define XTEN_PAGE_SIZE (1U << XTEN_PAGE_SHIFT)
+#define XTEN_PAGE_TABLE_SHIFT 22
+#define XTEN_PAGE_DIRECTORY_SIZE (1U << (32 - XTEN_PAGE_TABLE_SHIFT))
+#define XTEN_PAGES_PER_TABLE (1U << (XTEN_PAGE_TABLE_SHIFT - XTEN_PAGE_SHIFT))
+#define XTEN_PAGE_READ 0x01  // page is backed by host memory and can be read directly
+#define XTEN_PAGE_WRITE 0x02 // page is backed by host memory and can be written directly
+#define XTEN_PAGE_CODE 0x04  // instructions on this page have been fetched into the decode cache
+#define XTEN_PAGE_BREAK 0x08 // at least one instruction breakpoint is set on this page
+#define XTEN_PAGE_WATCH 0x10 // at least one data breakpoint covers part of this page so loads and stores take the slow path
+#define XTEN_PAGE_SNAPSHOT 0x20 // writable page saved by a snapshot and not written since WRITE is cleared until the first store
+#define XTEN_PAGE_MMIO 0x40     // at least one bus device covers part of this page so accesses the memory map misses search the bus
+
+/*Decode cache defines*/
+#define XTEN_DECODE_CACHE_SIZE 4096 // number of entries must be a power of two
+#define XTEN_MAX_INSTRUCTION_SIZE 3 // largest instruction so a write can change instructions starting up to 2 bytes before it
+#define XTEN_DECODE_BREAK 0x01      // execution stops before the instruction in this entry
+#define XTEN_DECODE_EDGE 0x02       // the instruction can change the flow of control so the edge it takes is counted by coverage
+#define XTEN_DECODE_FETCH 0x04      // the fetch cache model looks at the line of whatever runs after this instruction
+#define XTEN_DECODE_TIMING 0x08     // the timing model charges the cycles above XTEN_DECODE_CYCLES_SHIFT and any taken branch
+#define XTEN_DECODE_FAULT 0x10      // the read callback raised a memory fault fetching the instruction so it must not run
+#define XTEN_DECODE_CYCLES_SHIFT 8  // flags bits from here up hold the extra cycles the timing model worked out at decode
+#define XTEN_DECODE_SECONDARY 0x80  // primary decode table entry names a secondary table instead of an instruction
+#define XTEN_FUSE_MAX_INSTRUCTIONS 3 // longest run of instructions the interpreter fuses into one superinstruction
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(XTEN_NO_COMPUTED_GOTO)
+#define XTEN_COMPUTED_GOTO // xten_run dispatches with labels as values define XTEN_NO_COMPUTED_GOTO to use a switch instead
+#endif
+
+/*JIT defines only used with XTEN_ENABLE_JIT*/
+#define XTEN_JIT_CODE_SIZE (4 * 1024 * 1024) // executable memory for translated blocks everything is flushed when it fills up
+#define XTEN_JIT_BLOCK_COUNT 4096            // translated blocks are direct mapped by address must be a power of two
+#define XTEN_JIT_MAX_BLOCK 32                // most instructions translated into one block
+#define XTEN_JIT_MAX_BLOCK_BYTES 8192        // room left in the code memory before a block is translated
+#define XTEN_JIT_RAS_SIZE 16                 // return addresses remembered for RET must be a power of two
+
+/*Bus defines*/
+#define XTEN_MAX_BUS_DEVICES 32 // address ranges device models can register with xten_mapDevice
+
+/*Native function defines*/
+#define XTEN_MAX_NATIVE_FUNCTIONS 128 // call targets that can be handled by host code with xten_addNativeFunction
+#define XTEN_NATIVE_CHUNK 256         // bytes the block helpers move between guest and host at a time
+
+/*Extension defines*/
+#define XTEN_MAX_CUSTOM_INSTRUCTIONS 32 // designer defined opcodes that can be registered with xten_addCustomInstruction
+#define XTEN_USER_REGISTER_COUNT 256    // user registers RUR and WUR can name
+
+/*Debug defines*/
+#define XTEN_MAX_BREAKPOINTS 64 // software breakpoints
+#define XTEN_IBREAK_COUNT 16    // IBREAKA0..15 hardware breakpoints
+#define XTEN_DBREAK_COUNT 16    // DBREAKA0..15 and DBREAKC0..15 data breakpoints
+#define XTEN_DBREAKC_MASK 0x3F        // DBREAKC bits compared against the low address bits a zero bit ignores that address bit
+#define XTEN_DBREAKC_LOAD 0x40000000  // DBREAKC LB break on loads
+#define XTEN_DBREAKC_STORE 0x80000000 // DBREAKC SB break on stores
+#define XTEN_DEBUGCAUSE_DBREAK 0x04   // DEBUGCAUSE DB a data breakpoint was hit
+#define XTEN_DEBUGCAUSE_DBNUM_SHIFT 8 // DEBUGCAUSE DBNUM which data breakpoint was hit
+
+/*Exception defines EXCCAUSE values from the ISA*/
+#define XTEN_EXCCAUSE_ILLEGAL_INSTRUCTION 0     // IllegalInstructionCause
+#define XTEN_EXCCAUSE_INSTRUCTION_FETCH_ERROR 2 // InstructionFetchErrorCause
+#define XTEN_EXCCAUSE_LOAD_STORE_ERROR 3        // LoadStoreErrorCause
+
+/*Lockstep defines*/
+#define XTEN_LOCKSTEP_BLOCK 32          // most instructions the checked engine runs between two comparisons
+#define XTEN_LOCKSTEP_MAX_ACCESSES 64   // most memory accesses logged for one block of instructions
+#define XTEN_LOCKSTEP_REPORT_SIZE 256   // bytes of text describing a divergence
+
+/*Coverage defines*/
+#define XTEN_COVERAGE_HASH 0x9E3779B1U // multiplier spreading instruction addresses over the coverage bitmap
+
+/*Fetch cache model defines*/
+#define XTEN_FETCH_CACHE_SIZE (32 * 1024) // bytes of instruction cache in front of the modelled region
+#define XTEN_FETCH_CACHE_LINE 32          // bytes per line must be a power of two
+#define XTEN_FETCH_CACHE_LINES (XTEN_FETCH_CACHE_SIZE / XTEN_FETCH_CACHE_LINE)
+
+/*Timing model defines LX106 costs used by xten_lx106Timing in cycles on top of the one every instruction takes*/
+#define XTEN_LX106_LOAD_USE_CYCLES 1     // the instruction after a load reads the register it loaded
+#define XTEN_LX106_TAKEN_BRANCH_CYCLES 2 // the fetched instructions after a taken jump, call, return or branch are thrown away
+#define XTEN_LX106_L32R_CYCLES 1         // literal loads go out to the literal pool beside the code
+#define XTEN_LX106_MMIO_CYCLES 4         // wait states of a peripheral access
+
+/*Record and replay defines*/
+#define XTEN_REPLAY_MAGIC 0x52525458 // "XTRR" at the start of every recording
+#define XTEN_REPLAY_VERSION 1
+#define XTEN_EVENT_READ 1      // value returned by the read callback
+#define XTEN_EVENT_INTERRUPT 2 // interrupt bits injected by the user
+
     typedef struct Xtensa_lx_CPU Xtensa_lx_CPU;
 
     static inline void xten_decodeQRST(Xtensa_lx_CPU *CPU, uint32_t opcode);
@@ -46,6 +172,43 @@ extern "C"
     static inline void xten_coreProcessorControlInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode);
     static inline void xten_coreMemoryOrderingInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode);
 
+    static inline uint32_t xten_readMemory(Xtensa_lx_CPU *CPU, uint32_t address);
+    static inline void xten_writeMemory(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes);
+    static inline void xten_invalidateCode(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t length);
+    static inline uint32_t xten_helper_readCallback(Xtensa_lx_CPU *CPU, uint32_t address);
+    static inline uint32_t xten_helper_busRead(Xtensa_lx_CPU *CPU, uint32_t address);
+    static inline void xten_helper_writeCallback(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes);
+    static inline void xten_helper_replayInterrupts(Xtensa_lx_CPU *CPU);
+    static inline void xten_helper_illegalOpcode(Xtensa_lx_CPU *CPU, uint32_t opcode);
+    static inline void xten_helper_customInstruction(Xtensa_lx_CPU *CPU, uint32_t opcode);
+#ifdef XTEN_ENABLE_JIT
+    static inline uint32_t xten_helper_jitRun(Xtensa_lx_CPU *CPU, uint32_t maxInstructions, bool resume);
+    static inline void xten_helper_jitFree(Xtensa_lx_CPU *CPU);
+#endif
+
+#include "XtensaLX_decodeTables.h"
+
+    /*superinstructions the interpreter runs with one dispatch numbered after the XTEN_OP_* instructions*/
+    enum
+    {
+        XTEN_FUSED_L32R_CALLX0 = XTEN_OP_COUNT, // call through a literal
+        XTEN_FUSED_MOVI_BRANCH,                 // compare against a constant
+        XTEN_FUSED_EXTUI_BRANCH,                // test a bit field
+        XTEN_FUSED_L32I_ADDI_S32I,              // counter in memory
+        XTEN_DISPATCH_COUNT
+    };
+
+// X(name, first handler, second handler) for every two instruction superinstruction in XTEN_FUSED_* order
+// fusedOps[i] is whichever instruction the entry fused at that place such as the branch after a MOVI
+#define XTEN_FOR_EACH_FUSED_PAIR(X)                               \
+    X(L32R_CALLX0, xten_coreL32R, xten_coreCALLX0)                \
+    X(MOVI_BRANCH, xten_coreMOVI, xten_opHandlers[fusedOps[0]])   \
+    X(EXTUI_BRANCH, xten_coreEXTUI, xten_opHandlers[fusedOps[0]])
+
+// X(name, first handler, second handler, third handler) for every three instruction superinstruction after the pairs
+#define XTEN_FOR_EACH_FUSED_TRIPLE(X) \
+    X(L32I_ADDI_S32I, xten_coreL32I, xten_coreADDI, xten_coreS32I)
+
     void xten_helper_printBinary(uint32_t value);
     void xten_helper_printRegisters(uint32_t *reg_file, uint32_t offset);
     uint32_t xten_helper_signExtend32Bits(uint32_t value, int bits);
@@ -70,6 +233,364 @@ extern "C"
      */
     typedef void (*MemoryWriteCallback)(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes, void *context);
 
+    /**
+     * @brief Function pointer type for reads from a device model on the bus
+     *
+     * Works like MemoryReadCallback but is handed the offset from the start of the range the device registered and the
+     * pointer it registered with instead of the CPU callback context. CPU->debugRead is set when a debugger is the one reading
+     * and the device should then hand back what a load would see without side effects such as popping a FIFO.
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param offset The address being read minus the start of the device range.
+     * @param device The pointer passed to xten_mapDevice.
+     * @return The byte at offset in the most significant bits followed by the next three.
+     */
+    typedef uint32_t (*DeviceReadCallback)(Xtensa_lx_CPU *CPU, uint32_t offset, void *device);
+
+    /**
+     * @brief Function pointer type for writes to a device model on the bus
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param offset The address being written minus the start of the device range.
+     * @param value The low numBytes bytes are written the most significant of them at offset.
+     * @param device The pointer passed to xten_mapDevice.
+     */
+    typedef void (*DeviceWriteCallback)(Xtensa_lx_CPU *CPU, uint32_t offset, uint32_t value, int numBytes, void *device);
+
+    /**
+     * @brief struct representing one address range a device model registered on the bus
+     */
+    typedef struct Xtensa_lx_BusDevice
+    {
+        uint32_t start;            // first guest address of the range
+        uint32_t last;             // last guest address of the range so a range can end at the top of memory
+        DeviceReadCallback read;   // NULL for write only registers reads give zero
+        DeviceWriteCallback write; // NULL for read only registers writes are dropped
+        void *device;              // handed back to read and write
+    } Xtensa_lx_BusDevice;
+
+    /**
+     * @brief Function pointer type for host code standing in for a guest function
+     *
+     * Runs in place of the function a CALL0 or CALLX0 was about to enter. Arguments are in a2 to a7 the way the call0 ABI
+     * passes them and the result goes in a2. The call returns to a0 as soon as this returns.
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param context The pointer passed to xten_addNativeFunction.
+     */
+    typedef void (*NativeFunctionCallback)(Xtensa_lx_CPU *CPU, void *context);
+
+    /**
+     * @brief struct representing one call target handled by host code
+     */
+    typedef struct Xtensa_lx_NativeFunction
+    {
+        uint32_t address;                // guest address of the function
+        NativeFunctionCallback function; // host code to run instead
+        void *context;                   // handed back to function
+    } Xtensa_lx_NativeFunction;
+
+    /**
+     * @brief Function pointer type for host code executing a designer defined instruction
+     *
+     * Gets the whole opcode so it can take its operands from any field and works on CPU->registerFile and
+     * CPU->userRegisters directly. It must not change CPU->PC since TIE instructions cannot branch. Raising an exception
+     * with xten_helper_illegalInstruction or a memory fault stops the run the same way a core instruction does.
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param opcode The 24 bit opcode laid out the same way as for the core handlers.
+     * @param context The pointer passed to xten_addCustomInstruction.
+     */
+    typedef void (*CustomInstructionCallback)(Xtensa_lx_CPU *CPU, uint32_t opcode, void *context);
+
+    /**
+     * @brief struct representing one designer defined instruction
+     */
+    typedef struct Xtensa_lx_CustomInstruction
+    {
+        uint32_t match;                     // opcode bits under mask
+        uint32_t mask;                      // opcode bits that identify the instruction the rest are operands
+        CustomInstructionCallback function; // host code executing it
+        void *context;                      // handed back to function
+    } Xtensa_lx_CustomInstruction;
+
+    /**
+     * @brief struct representing a single 4KB page of the memory map
+     *
+     * Pages that are backed by host memory point at that memory directly so loads, stores and instruction fetches can skip
+     * the user callbacks. Pages without host memory fall back to the MemoryReadCallback and MemoryWriteCallback.
+     */
+    typedef struct Xtensa_lx_Page
+    {
+        uint8_t *host;  // host memory holding this page or NULL when the callbacks handle it
+        uint32_t flags; // XTEN_PAGE_* bits describing how the page may be accessed
+        uint32_t snapshotIndex; // which saved copy in the active snapshot belongs to this page
+    } Xtensa_lx_Page;
+
+    /**
+     * @brief struct counting fetch cache hits and misses for one line of the modelled region
+     */
+    typedef struct Xtensa_lx_LineStats
+    {
+        uint32_t hits;
+        uint32_t misses;
+    } Xtensa_lx_LineStats;
+
+    /**
+     * @brief struct representing the fetch cache model
+     *
+     * Direct mapped with one tag per line. The tag is the line address with the low bit set so a zeroed array is empty.
+     */
+    typedef struct Xtensa_lx_FetchCache
+    {
+        uint32_t base;              // first address of the modelled region
+        uint32_t size;              // bytes in the modelled region
+        uint32_t missCycles;        // added to CCOUNT for every miss
+        uint32_t lastLine;          // line looked up last so running along a line does not count it again
+        uint64_t hits;              // lines found in the cache
+        uint64_t misses;            // lines that had to be filled
+        Xtensa_lx_LineStats *lines; // counts for every line of the region owned by the user or NULL
+        uint32_t tags[XTEN_FETCH_CACHE_LINES];
+    } Xtensa_lx_FetchCache;
+
+    /**
+     * @brief struct holding the cycle costs of the timing model
+     *
+     * Every field is a number of cycles added to CCOUNT on top of the one every instruction takes.
+     */
+    typedef struct Xtensa_lx_Timing
+    {
+        uint32_t loadUse;     // the instruction after a load reads the register the load wrote
+        uint32_t takenBranch; // a jump, call, return or branch sent the program counter anywhere but the next instruction
+        uint32_t l32r;        // every L32R
+        uint32_t mmioWait;    // every read or write that misses the memory map and goes to a device or the callbacks
+    } Xtensa_lx_Timing;
+
+    /*pipeline of the LX106 in the ESP8266*/
+    static const Xtensa_lx_Timing xten_lx106Timing = {XTEN_LX106_LOAD_USE_CYCLES, XTEN_LX106_TAKEN_BRANCH_CYCLES, XTEN_LX106_L32R_CYCLES,
+                                                      XTEN_LX106_MMIO_CYCLES};
+
+    /**
+     * @brief struct representing one entry of the decode cache
+     *
+     * The decode cache is direct mapped by program counter and holds the opcode fetched from that address so running code does
+     * not go back through the memory map or callbacks for every instruction.
+     */
+    typedef struct Xtensa_lx_DecodeEntry
+    {
+        uint32_t pc;         // address the opcode was fetched from
+        uint32_t generation; // the entry is only valid while this matches CPU->generation
+        uint32_t opcode;     // 24 bit opcode the same way xten_executeNext takes it
+        uint32_t flags;      // XTEN_DECODE_* bits worked out when the entry was filled
+        uint32_t edgeId;     // hashed address naming this instruction in the coverage bitmap
+        uint32_t op;         // XTEN_OP_* the decode tables gave for the opcode
+        void (*handler)(Xtensa_lx_CPU *CPU, uint32_t opcode); // executes the opcode taken from xten_opHandlers
+        uint32_t dispatch;   // what the interpreter jumps to op or one of the XTEN_FUSED_* superinstructions starting here
+        uint32_t fusedOpcodes[XTEN_FUSE_MAX_INSTRUCTIONS - 1]; // opcodes after the first one of a superinstruction
+        uint8_t fusedOps[XTEN_FUSE_MAX_INSTRUCTIONS - 1];      // and the XTEN_OP_* they decoded to
+    } Xtensa_lx_DecodeEntry;
+
+    /**
+     * @brief struct holding the instruction mix counters of one CPU only there with XTEN_ENABLE_STATS
+     *
+     * Counts are plain integers owned by the CPU so a CPU must not be run from two threads at once. Family and load or store
+     * width totals are added up from ops by xten_statsFamily, xten_statsLoads and xten_statsStores.
+     */
+    typedef struct Xtensa_lx_Stats
+    {
+        uint64_t ops[XTEN_OP_COUNT]; // instructions run indexed by XTEN_OP_* name them with xten_opNames
+        uint64_t branchesTaken;      // conditional branches that went to their target
+        uint64_t branchesNotTaken;   // conditional branches that fell through
+    } Xtensa_lx_Stats;
+
+    /**
+     * @brief struct caching where a block went last so translated code can jump straight to the next block
+     *
+     * The entry is only followed while block still holds a translation of target so it never has to be cleared when the
+     * slot is reused.
+     */
+    typedef struct Xtensa_lx_JitCache
+    {
+        uint32_t target;                  // guest address the block jumped to
+        struct Xtensa_lx_JitBlock *block; // block table slot target was found in
+    } Xtensa_lx_JitCache;
+
+    /**
+     * @brief struct representing one basic block translated by the JIT
+     */
+    typedef struct Xtensa_lx_JitBlock
+    {
+        uint32_t pc;                 // guest address of the first instruction
+        uint32_t length;             // number of instructions in the block
+        bool breakAtStart;           // the first instruction has a breakpoint on it
+        uint8_t *code;               // x86-64 code NULL when the slot is empty
+        uint8_t *entry;              // where blocks chaining to this one jump in past the prologue the exit stub when empty
+        Xtensa_lx_JitCache exits[2]; // inline caches for the end of the block the second is the fall through of a branch
+    } Xtensa_lx_JitBlock;
+
+    /**
+     * @brief struct holding the JIT block table followed by its code memory in one executable mapping
+     */
+    typedef struct Xtensa_lx_Jit
+    {
+        uint8_t *code;                   // XTEN_JIT_CODE_SIZE bytes of executable memory
+        size_t codeUsed;                 // bytes of code written since the last flush
+        uint32_t generation;             // CPU->generation the blocks were translated under
+        uint8_t *stub;                   // code leaving translated code for chains that have nowhere to go
+        uint32_t rasTop;                 // index of the newest return address
+        uint32_t ras[XTEN_JIT_RAS_SIZE]; // return addresses of CALL0 and CALLX0 predicting where RET goes
+        Xtensa_lx_JitBlock blocks[XTEN_JIT_BLOCK_COUNT];
+    } Xtensa_lx_Jit;
+
+    /**
+     * @brief reasons xten_run can return before running every instruction it was asked to
+     */
+    typedef enum Xtensa_lx_StopReason
+    {
+        XTEN_STOP_NONE = 0,       // ran the number of instructions asked for or the chip was disabled
+        XTEN_STOP_BREAKPOINT = 1, // the next instruction has a software or IBREAKA breakpoint on it
+        XTEN_STOP_WATCHPOINT = 2, // the last instruction loaded or stored an address covered by a DBREAKA breakpoint
+        XTEN_STOP_ILLEGAL_INSTRUCTION = 3, // the last instruction was illegal or is not implemented EPC1 holds its address
+        XTEN_STOP_MEMORY_FAULT = 4,        // a callback reported the last instruction accessed memory that does not exist
+    } Xtensa_lx_StopReason;
+
+    /**
+     * @brief Function pointer type for hooks run before or after every instruction
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param pc The address of the instruction.
+     * @param opcode The 24 bit opcode laid out the same way as for the core handlers.
+     * @param context The context in the Xtensa_lx_Hooks passed to xten_setHooks.
+     */
+    typedef void (*InstructionHook)(Xtensa_lx_CPU *CPU, uint32_t pc, uint32_t opcode, void *context);
+
+    /**
+     * @brief Function pointer type for hooks run after every load or store instruction
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param address The guest address accessed.
+     * @param value The value stored or the value the load put in its register.
+     * @param numBytes 1, 2 or 4.
+     * @param write Set for stores.
+     * @param context The context in the Xtensa_lx_Hooks passed to xten_setHooks.
+     */
+    typedef void (*MemoryHook)(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes, bool write, void *context);
+
+    /**
+     * @brief Function pointer type for hooks run after every jump, call, return and conditional branch
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param from The address of the instruction.
+     * @param to Where the program counter went.
+     * @param taken Set when to is not the next instruction.
+     * @param context The context in the Xtensa_lx_Hooks passed to xten_setHooks.
+     */
+    typedef void (*BranchHook)(Xtensa_lx_CPU *CPU, uint32_t from, uint32_t to, bool taken, void *context);
+
+    /**
+     * @brief Function pointer type for hooks run after an instruction raises an exception
+     *
+     * @param CPU A pointer to the current CPU context EXCCAUSE, EXCVADDR and EPC1 are already set.
+     * @param reason XTEN_STOP_ILLEGAL_INSTRUCTION or XTEN_STOP_MEMORY_FAULT.
+     * @param context The context in the Xtensa_lx_Hooks passed to xten_setHooks.
+     */
+    typedef void (*ExceptionHook)(Xtensa_lx_CPU *CPU, Xtensa_lx_StopReason reason, void *context);
+
+    /**
+     * @brief struct holding the instrumentation hooks any of them can be NULL
+     */
+    typedef struct Xtensa_lx_Hooks
+    {
+        InstructionHook preInstruction;  // before the instruction runs
+        InstructionHook postInstruction; // after the instruction and every other hook for it
+        MemoryHook memory;               // after a load or store that did not fault
+        BranchHook branch;               // after a jump, call, return or conditional branch taken or not
+        ExceptionHook exception;         // after an instruction stopped the CPU with an exception
+        void *context;                   // handed back to every hook
+    } Xtensa_lx_Hooks;
+
+    /**
+     * @brief struct representing one input recorded from outside the CPU
+     *
+     * Recordings are a header followed by these events in the order they happened each field stored as 4 little-endian bytes.
+     */
+    typedef struct Xtensa_lx_ReplayEvent
+    {
+        uint32_t kind;    // XTEN_EVENT_READ or XTEN_EVENT_INTERRUPT
+        uint32_t ccount;  // CCOUNT when the event happened
+        uint32_t address; // address read for XTEN_EVENT_READ unused for interrupts
+        uint32_t value;   // value read or interrupt bits injected
+    } Xtensa_lx_ReplayEvent;
+
+    /**
+     * @brief struct representing one memory access made by an instruction
+     */
+    typedef struct Xtensa_lx_MemoryAccess
+    {
+        uint32_t address;
+        uint32_t value;    // value read from the callback or the low numBytes bytes written
+        uint32_t previous; // host memory bytes a store replaced laid out like value 0 for reads
+        int numBytes;
+    } Xtensa_lx_MemoryAccess;
+
+    /**
+     * @brief struct listing the accesses of one block of instructions that a lockstep check needs to see
+     *
+     * Reads are only logged when they go to the read callback because those are the ones that cannot be repeated. Every store
+     * is logged along with the host memory it replaced so the reference can see memory as it was before the block.
+     */
+    typedef struct Xtensa_lx_AccessLog
+    {
+        Xtensa_lx_MemoryAccess reads[XTEN_LOCKSTEP_MAX_ACCESSES];
+        uint32_t readCount;
+        Xtensa_lx_MemoryAccess writes[XTEN_LOCKSTEP_MAX_ACCESSES];
+        uint32_t writeCount;
+    } Xtensa_lx_AccessLog;
+
+    /**
+     * @brief Appends an access to one of the lists of an access log dropping it when the list is full
+     */
+    static inline void xten_helper_logAccess(Xtensa_lx_MemoryAccess *list, uint32_t *count, uint32_t address, uint32_t value, uint32_t previous, int numBytes)
+    {
+        if (*count < XTEN_LOCKSTEP_MAX_ACCESSES)
+        {
+            list[*count].address = address;
+            list[*count].value = value;
+            list[*count].previous = previous;
+            list[*count].numBytes = numBytes;
+            (*count)++;
+        }
+    }
+
+    /**
+     * @brief struct holding what is needed to put a CPU back to an earlier point
+     *
+     * Only registers and host backed writable pages are saved anything behind the callbacks is up to the user. Pages are write
+     * protected while the snapshot is active so the first store to each one lists it as dirty and restoring only copies those.
+     */
+    typedef struct Xtensa_lx_Snapshot
+    {
+        Xtensa_lx_CPU *CPU;              // CPU the snapshot was taken of
+        uint32_t registers[DEFAULT_REGISTER_FILE_SIZE];
+        uint32_t PC;
+        uint32_t sar;
+        int windowOffset;
+        uint32_t ccount;
+        uint32_t interrupt;
+        uint32_t intenable;
+        uint32_t exccause;
+        uint32_t excvaddr;
+        uint32_t epc1;
+        uint32_t debugcause;
+        uint32_t userRegisters[XTEN_USER_REGISTER_COUNT];
+        uint32_t pageCount;              // number of saved pages
+        uint32_t *pageAddresses;         // guest address of each saved page
+        Xtensa_lx_Page **pages;          // memory map entry of each saved page
+        uint8_t *pageData;               // XTEN_PAGE_SIZE bytes saved for each page
+        uint32_t *dirty;                 // indexes of pages written since the snapshot was taken or last restored
+        uint32_t dirtyCount;
+    } Xtensa_lx_Snapshot;
+
     /**
      * @brief struct representing an Xtensa CPU
      *
@@ -102,6 +623,80 @@ extern "C"
 
         void *callbackContext; // this allows the user to pass in any data they need to the callback implementations
 
+        uint32_t registerStorage[DEFAULT_REGISTER_FILE_SIZE]; // registerFile points here so the register file is part of the CPU block
+
+        Xtensa_lx_Page *pageDirectory[XTEN_PAGE_DIRECTORY_SIZE]; // page tables for the memory map NULL when no page in that 4MB is mapped
+
+        Xtensa_lx_BusDevice busDevices[XTEN_MAX_BUS_DEVICES]; // device ranges sorted by start address
+        uint32_t busDeviceCount;                              // number of busDevices in use
+
+        Xtensa_lx_NativeFunction nativeFunctions[XTEN_MAX_NATIVE_FUNCTIONS]; // call targets run on the host sorted by address
+        uint32_t nativeFunctionCount;                                        // number of nativeFunctions in use
+
+        uint32_t userRegisters[XTEN_USER_REGISTER_COUNT];                               // TIE state RUR and WUR move to and from the address registers
+        uint32_t userRegisterMask[XTEN_USER_REGISTER_COUNT / 32];                       // bit set for every user register added with xten_addUserRegister
+        uint32_t userRegisterCount;                                                     // number of bits set in userRegisterMask
+        Xtensa_lx_CustomInstruction customInstructions[XTEN_MAX_CUSTOM_INSTRUCTIONS]; // designer defined instructions in the order they were added
+        uint32_t customInstructionCount;                                                // number of customInstructions in use
+
+        uint8_t *arenaBase; // start of the arena that follows the CPU struct in the same block
+        size_t arenaSize;   // bytes available in the arena
+        size_t arenaUsed;   // bytes handed out so far arena memory is only given back when the whole block is
+        uint32_t generation; // bumped on reset so anything cached in the arena can be invalidated without clearing it
+        uint8_t ownsBlock;   // set when xten_createCPU allocated the block and xten_freeCPU should free it
+
+        Xtensa_lx_DecodeEntry *decodeCache; // taken from the arena the first time xten_step runs NULL until then
+
+        uint32_t ccount;    // cycle count special register counts one per instruction
+        uint32_t interrupt; // pending interrupt bits read through RSR.INTERRUPT
+        uint32_t intenable; // interrupt enable bits
+
+        FILE *recordFile;                  // set while every input from outside the CPU is being logged
+        FILE *replayFile;                  // set while inputs come from a recording instead of the user
+        Xtensa_lx_ReplayEvent replayEvent; // next event of the recording
+        bool replayHasEvent;               // false once the recording runs out
+        bool replayDiverged;               // set when execution asked for an input the recording does not have next
+
+        Xtensa_lx_StopReason stopReason;              // why the last xten_run returned
+        Xtensa_lx_DecodeEntry fetchScratch;           // used in place of the decode cache when the arena had no room for it
+        uint32_t breakpoints[XTEN_MAX_BREAKPOINTS];   // software breakpoint addresses
+        uint32_t breakpointCount;                     // number of software breakpoints in use
+        uint32_t breakPc;                             // program counter the last breakpoint stop left the CPU at
+        bool breakStopped;                            // the last xten_run stopped at breakPc so the next one runs that instruction
+        uint32_t ibreaka[XTEN_IBREAK_COUNT];          // IBREAKA special registers
+        uint32_t ibreakenable;                        // IBREAKENABLE special register one bit per IBREAKA
+        uint32_t dbreaka[XTEN_DBREAK_COUNT];          // DBREAKA special registers
+        uint32_t dbreakc[XTEN_DBREAK_COUNT];          // DBREAKC special registers
+        uint32_t debugcause;                          // DEBUGCAUSE special register
+        uint32_t watchAddress;                        // address of the access that hit the last data breakpoint
+        bool debugRead;                               // set while a debugger reads a device so the read changes nothing
+
+        uint32_t exccause; // EXCCAUSE special register
+        uint32_t excvaddr; // EXCVADDR special register
+        uint32_t epc1;     // EPC1 special register
+
+        Xtensa_lx_Snapshot *snapshot; // snapshot whose pages are being tracked NULL when there is none
+        Xtensa_lx_AccessLog *accessLog; // set only while a lockstep check runs a block
+
+        uint8_t *coverageMap;  // edge hit counts NULL when coverage is off
+        uint32_t coverageMask; // size of coverageMap minus one
+
+        Xtensa_lx_FetchCache *fetchCache;       // NULL when the fetch cache model is off
+        Xtensa_lx_FetchCache *fetchCacheMemory; // taken from the arena the first time the model is turned on
+
+        Xtensa_lx_Timing timing; // costs of the timing model all zero while it is off
+        bool timingEnabled;      // set while xten_setTiming has a model in place
+
+        Xtensa_lx_Hooks hooks; // instrumentation installed by xten_setHooks
+        bool hooksEnabled;     // set while hooks are installed so xten_step and xten_run take the hooked path
+
+#ifdef XTEN_ENABLE_STATS
+        Xtensa_lx_Stats stats; // instruction mix counted by xten_step and xten_run cleared by xten_clearStats
+#endif
+
+        Xtensa_lx_Jit *jit; // translated code created by the first xten_run with XTEN_ENABLE_JIT
+        bool jitFailed;     // no executable memory could be mapped so xten_run interprets
+
     } Xtensa_lx_CPU;
 
     /**
@@ -117,6 +712,10 @@ extern "C"
     {
         // because core architecture is all that is implemented at the moment all opcodes are 24 bits
         uint32_t opcode = CPU->dataBus >> 8;
+        if (CPU->replayFile != NULL)
+        {
+            xten_helper_replayInterrupts(CPU); // interrupts recorded before this instruction are delivered at the same CCOUNT
+        }
         xten_decodeOp0(CPU, opcode); // this will set things to decode and execute opcode
         // may result in an execute next with a flag set to do a process other then decoding and executing an instruction
         // this is to allow the user to process certain stages in the pipeline for the instruction that may require such processing
@@ -124,6 +723,7 @@ extern "C"
         // increment the CPU->PC and address appropriately
         CPU->PC += 3;
         CPU->addressLines = CPU->PC;
+        CPU->ccount++;
     }
 
     /**
@@ -161,6 +761,7 @@ extern "C"
         if (CPU->configurable)
         {
             CPU->msbFirstOption = (flag <= 0) ? XTEN_MSB_OFF : XTEN_MSB_ON;
+            CPU->generation++; // cached instructions were decoded with the other field layout
         }
     }
 
@@ -247,18 +848,44 @@ extern "C"
     // Clock pulse function goes here
 
     /**
-     * @brief Creates a new Xtensa_lx_CPU object
+     * @brief Returns the number of bytes a CPU block needs
      *
-     * This function creates a new Xtensa_lx_CPU object with default values that can be changed directly by a confident user
-     * or with functions designated to change CPU options prefixed with xten_ops_
+     * Every CPU is a single contiguous block holding the Xtensa_lx_CPU struct followed by an arena that the memory map and
+     * caches are carved out of. This function gives the size of that block for a given arena size so a user can allocate it
+     * however they like and hand it to xten_initCPUInPlace.
      *
-     * @return Xtensa_lx_CPU with default options
+     * @param arenaSize size_t number of bytes wanted for the arena
+     * @return size_t number of bytes the whole block needs
      */
-    Xtensa_lx_CPU *xten_createCPU(MemoryReadCallback readMemory, MemoryWriteCallback writeMemory, void *callbackContext)
+    size_t xten_cpuFootprint(size_t arenaSize)
+    {
+        return XTEN_ALIGN_UP(sizeof(Xtensa_lx_CPU)) + arenaSize;
+    }
+
+    /**
+     * @brief Initializes an Xtensa_lx_CPU inside memory owned by the user
+     *
+     * This function places a CPU with default values at the start of the passed in block and uses the rest of the block as that
+     * CPU's arena. No allocation is done so the block can come from a pool, the stack or a memory mapped file.
+     *
+     * @param block memory to build the CPU in must be aligned to XTEN_ARENA_ALIGNMENT
+     * @param blockSize size_t size of the block should come from xten_cpuFootprint
+     * @param readMemory MemoryReadCallback used for addresses the memory map does not cover
+     * @param writeMemory MemoryWriteCallback used for addresses the memory map does not cover
+     * @param callbackContext data passed to the callbacks
+     * @return Xtensa_lx_CPU pointer into block or NULL if the block is too small or a callback is missing
+     */
+    Xtensa_lx_CPU *xten_initCPUInPlace(void *block, size_t blockSize, MemoryReadCallback readMemory, MemoryWriteCallback writeMemory, void *callbackContext)
     {
-        Xtensa_lx_CPU *resultingCPU;
-        resultingCPU = (Xtensa_lx_CPU *)malloc(sizeof(Xtensa_lx_CPU));
-        resultingCPU->registerFile = (uint32_t *)malloc(DEFAULT_REGISTER_FILE_SIZE * sizeof(uint32_t));
+        // ensure that the funcitons for memory read and write are implemented if not the CPU should be NULL for easy handeling of errors for the user
+        if (block == NULL || blockSize < xten_cpuFootprint(0) || readMemory == NULL || writeMemory == NULL || callbackContext == NULL)
+        {
+            return NULL;
+        }
+
+        Xtensa_lx_CPU *resultingCPU = (Xtensa_lx_CPU *)block;
+        memset(resultingCPU, 0, sizeof(Xtensa_lx_CPU)); // clears the register file and the page directory
+        resultingCPU->registerFile = resultingCPU->registerStorage;
         // resultingCPU->bRegisters = (bool *)malloc(BOOLEAN_REGISTER_AMOUNT * sizeof(bool));
         resultingCPU->windowOffset = 0;                // no offset for initial window wont move on core architecture so only 16 registers
         resultingCPU->PC = 0;                          // start at instruction at address zero
@@ -275,64 +902,4135 @@ extern "C"
 
         resultingCPU->sar = 0;
 
-        // TODO ensure that the funcitons for memory read and write are implemented if not the CPU should be NULL for easy handeling of errors for the user
-        if (readMemory == NULL || writeMemory == NULL || callbackContext == NULL)
+        resultingCPU->arenaBase = (uint8_t *)block + XTEN_ALIGN_UP(sizeof(Xtensa_lx_CPU));
+        resultingCPU->arenaSize = blockSize - XTEN_ALIGN_UP(sizeof(Xtensa_lx_CPU));
+        resultingCPU->arenaUsed = 0;
+        resultingCPU->generation = 0;
+        resultingCPU->ownsBlock = false;
+
+        return resultingCPU;
+    }
+
+    /**
+     * @brief Creates a new Xtensa_lx_CPU object
+     *
+     * This function creates a new Xtensa_lx_CPU object with default values that can be changed directly by a confident user
+     * or with functions designated to change CPU options prefixed with xten_ops_. The CPU and its arena are one allocation of
+     * XTEN_DEFAULT_ARENA_SIZE extra bytes.
+     *
+     * @return Xtensa_lx_CPU with default options or NULL if a callback is missing or the allocation failed
+     */
+    Xtensa_lx_CPU *xten_createCPU(MemoryReadCallback readMemory, MemoryWriteCallback writeMemory, void *callbackContext)
+    {
+        size_t blockSize = xten_cpuFootprint(XTEN_DEFAULT_ARENA_SIZE);
+        void *block = malloc(blockSize);
+        Xtensa_lx_CPU *resultingCPU = xten_initCPUInPlace(block, blockSize, readMemory, writeMemory, callbackContext);
+
+        if (resultingCPU == NULL)
         {
-            resultingCPU = NULL;
+            free(block); // nothing should leak when the CPU could not be created
+            return NULL;
         }
+        resultingCPU->ownsBlock = true;
 
         return resultingCPU;
     }
 
     static inline void xten_freeCPU(Xtensa_lx_CPU *CPU)
     {
-        if (CPU != NULL)
+        if (CPU == NULL)
+        {
+            return;
+        }
+#ifdef XTEN_ENABLE_JIT
+        xten_helper_jitFree(CPU);
+#endif
+        if (CPU->ownsBlock)
         {
-            if (CPU->registerFile != NULL)
-            {
-                free(CPU->registerFile);
-            }
             free(CPU);
         }
     }
 
-    /****************************************This section is for decoding**************************************************************/
-
-    // array for easy decoding of the r field special values
-    uint32_t xten_table317[16] = {0xFFFFFFFF, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007, 0x00000008, 0x0000000A, 0x0000000C, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100};
+    /**
+     * @brief Resets the architectural state of a CPU without freeing anything
+     *
+     * This function clears the registers and program counter and puts the pins back to their power on state. The memory map,
+     * options and arena are kept and anything cached in the arena is invalidated by bumping the generation so this costs the
+     * same no matter how much has been cached.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to the CPU to reset
+     */
+    void xten_resetCPU(Xtensa_lx_CPU *CPU)
+    {
+        memset(CPU->registerStorage, 0, sizeof(CPU->registerStorage));
+        CPU->windowOffset = 0;
+        CPU->PC = 0;
+        CPU->sar = 0;
+        CPU->chipEnable = XTEN_HIGH;
+        CPU->write = XTEN_LOW;
+        CPU->addressLines = CPU->PC;
+        CPU->dataBus = 0;
+        CPU->ccount = 0;
+        CPU->interrupt = 0;
+        CPU->intenable = 0;
+        CPU->stopReason = XTEN_STOP_NONE;
+        CPU->breakStopped = false;
+        CPU->exccause = 0;
+        CPU->excvaddr = 0;
+        CPU->epc1 = 0;
+        CPU->generation++;
+    }
 
     /**
-     * @brief This decodes the passed in opcode fetched for the passed in CPU
+     * @brief Hands out memory from the arena of the passed in CPU
      *
-     * This function takes an Xtensa_lx_CPU and the opcode fetched for that CPU decodes and sends the opcode to be executed further
-     * down the pipeline or to further decoding steps.
+     * Arena memory is aligned to XTEN_ARENA_ALIGNMENT and lives as long as the CPU block does there is no way to give back a
+     * single allocation.
      *
-     * @param CPU address of the Xtensa CPU
-     * @param opcode uint32_t of the opcode the CPU should execute
+     * @param *CPU Xtensa_lx_CPU pointer owning the arena
+     * @param size size_t number of bytes wanted
+     * @return pointer to the memory or NULL when the arena is exhausted
      */
-    static inline void xten_decodeOp0(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    static inline void *xten_arenaAlloc(Xtensa_lx_CPU *CPU, size_t size)
     {
-        // extract op0 keep in mind all core opcodes are actually 24 bits in size
-        // op0 in all core opcodes when big endian is set
-        uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0x0F;
-#ifdef XTEN_DEBUGGING
-        printf("PC %X opcode %X:\n", CPU->PC, opcode);
-#endif
-#ifdef XTEN_DEBUGGING_DETAILED
-        printf("At CPU->PC %X opcode %X op0 was found to be %X:\n", CPU->PC, opcode, op0);
-#endif
-        switch (op0 >> 2)
+        size_t start = XTEN_ALIGN_UP(CPU->arenaUsed);
+        if (start > CPU->arenaSize || size > CPU->arenaSize - start)
         {
-        case 0x0:
-            switch (op0)
-            {
-            case 0x0:
-                // entering table decoding QRST193
-                xten_decodeQRST(CPU, opcode);
-                break;
-            case 0x1:
-                // goes to the L32R instruction
-                xten_coreLoadInstructions(CPU, opcode);
+            return NULL;
+        }
+        CPU->arenaUsed = start + size;
+        return CPU->arenaBase + start;
+    }
+
+    /**
+     * @brief struct representing a pool of CPU blocks
+     *
+     * All blocks live in one slab and free blocks are tracked with a stack of slot numbers so acquiring and releasing a CPU
+     * never calls malloc or free. Every slot also has an in use flag so a CPU released twice is only put on the stack once.
+     */
+    typedef struct Xtensa_lx_CPUPool
+    {
+        uint8_t *slab;       // slotCount blocks of slotSize bytes
+        size_t slotSize;     // size of every block including its arena
+        uint32_t slotCount;  // number of blocks in the slab
+        uint32_t freeCount;  // number of entries in freeSlots
+        uint32_t *freeSlots; // stack of the slot numbers not in use
+        uint8_t *inUse;      // one flag per slot set while its CPU is handed out
+    } Xtensa_lx_CPUPool;
+
+    /**
+     * @brief Creates a pool of CPU blocks
+     *
+     * This function makes one allocation holding the pool, its free list and slotCount CPU blocks each with arenaSize bytes
+     * of arena.
+     *
+     * @param slotCount uint32_t number of CPUs the pool can hand out at once
+     * @param arenaSize size_t arena bytes each CPU gets
+     * @return Xtensa_lx_CPUPool pointer or NULL if the allocation failed
+     */
+    Xtensa_lx_CPUPool *xten_createCPUPool(uint32_t slotCount, size_t arenaSize)
+    {
+        if (slotCount == 0)
+        {
+            return NULL;
+        }
+        size_t slotSize = XTEN_ALIGN_UP(xten_cpuFootprint(arenaSize));
+        size_t header = XTEN_ALIGN_UP(sizeof(Xtensa_lx_CPUPool)) + XTEN_ALIGN_UP(slotCount * sizeof(uint32_t)) + XTEN_ALIGN_UP(slotCount);
+        uint8_t *block = (uint8_t *)malloc(header + slotSize * slotCount);
+        if (block == NULL)
+        {
+            return NULL;
+        }
+
+        Xtensa_lx_CPUPool *pool = (Xtensa_lx_CPUPool *)block;
+        pool->freeSlots = (uint32_t *)(block + XTEN_ALIGN_UP(sizeof(Xtensa_lx_CPUPool)));
+        pool->inUse = (uint8_t *)pool->freeSlots + XTEN_ALIGN_UP(slotCount * sizeof(uint32_t));
+        memset(pool->inUse, 0, slotCount);
+        pool->slab = block + header;
+        pool->slotSize = slotSize;
+        pool->slotCount = slotCount;
+        pool->freeCount = slotCount;
+        for (uint32_t i = 0; i < slotCount; i++)
+        {
+            // lowest slot on top of the stack so blocks get handed out in address order
+            pool->freeSlots[i] = slotCount - 1 - i;
+        }
+        return pool;
+    }
+
+    /**
+     * @brief Takes a CPU from the pool and initializes it
+     *
+     * @param *pool Xtensa_lx_CPUPool pointer to take the CPU from
+     * @param readMemory MemoryReadCallback for the new CPU
+     * @param writeMemory MemoryWriteCallback for the new CPU
+     * @param callbackContext data passed to the callbacks
+     * @return Xtensa_lx_CPU with default options or NULL when the pool is empty or a callback is missing
+     */
+    Xtensa_lx_CPU *xten_poolAcquireCPU(Xtensa_lx_CPUPool *pool, MemoryReadCallback readMemory, MemoryWriteCallback writeMemory, void *callbackContext)
+    {
+        if (pool == NULL || pool->freeCount == 0)
+        {
+            return NULL;
+        }
+        uint32_t slot = pool->freeSlots[pool->freeCount - 1];
+        Xtensa_lx_CPU *CPU = xten_initCPUInPlace(pool->slab + (size_t)slot * pool->slotSize, pool->slotSize, readMemory, writeMemory, callbackContext);
+        if (CPU != NULL)
+        {
+            pool->freeCount--;
+            pool->inUse[slot] = 1;
+        }
+        return CPU;
+    }
+
+    /**
+     * @brief Gives a CPU back to the pool it came from
+     *
+     * Pointers that are not the start of a slot of this pool and CPUs that were already released are left alone.
+     *
+     * @param *pool Xtensa_lx_CPUPool pointer the CPU was acquired from
+     * @param *CPU Xtensa_lx_CPU pointer to release
+     * @return bool false if CPU was not handed out by this pool
+     */
+    bool xten_poolReleaseCPU(Xtensa_lx_CPUPool *pool, Xtensa_lx_CPU *CPU)
+    {
+        if (pool == NULL || CPU == NULL || (uint8_t *)CPU < pool->slab)
+        {
+            return false;
+        }
+        size_t offset = (size_t)((uint8_t *)CPU - pool->slab);
+        size_t slot = offset / pool->slotSize;
+        if (offset % pool->slotSize != 0 || slot >= pool->slotCount || !pool->inUse[slot])
+        {
+            return false;
+        }
+#ifdef XTEN_ENABLE_JIT
+        xten_helper_jitFree(CPU);
+#endif
+        pool->inUse[slot] = 0;
+        pool->freeSlots[pool->freeCount++] = (uint32_t)slot;
+        return true;
+    }
+
+    static inline void xten_freeCPUPool(Xtensa_lx_CPUPool *pool)
+    {
+        free(pool); // the pool, free list and every CPU block are one allocation
+    }
+
+    /****************************************This section is for the memory map**************************************************************/
+
+    /**
+     * @brief Finds the page entry for an address creating its page table if needed
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose memory map is used
+     * @param address uint32_t guest address
+     * @return Xtensa_lx_Page pointer or NULL when the arena is exhausted
+     */
+    static inline Xtensa_lx_Page *xten_helper_createPage(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_Page **table = &CPU->pageDirectory[address >> XTEN_PAGE_TABLE_SHIFT];
+        if (*table == NULL)
+        {
+            *table = (Xtensa_lx_Page *)xten_arenaAlloc(CPU, XTEN_PAGES_PER_TABLE * sizeof(Xtensa_lx_Page));
+            if (*table == NULL)
+            {
+                return NULL;
+            }
+            memset(*table, 0, XTEN_PAGES_PER_TABLE * sizeof(Xtensa_lx_Page));
+        }
+        return &(*table)[(address >> XTEN_PAGE_SHIFT) & (XTEN_PAGES_PER_TABLE - 1)];
+    }
+
+    /**
+     * @brief Maps a range of guest addresses onto host memory
+     *
+     * Loads, stores and fetches in a mapped range read and write the host memory directly instead of going through the user
+     * callbacks. When host is NULL zeroed memory for the range is taken from the CPU arena so a CPU together with its RAM stays
+     * one block. Both address and size have to be multiples of XTEN_PAGE_SIZE. The bytes are laid out the way the callbacks
+     * see them the byte at the lowest address is the most significant byte of a read.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to map memory for
+     * @param address uint32_t first guest address of the range
+     * @param size uint32_t size of the range in bytes
+     * @param host memory to back the range or NULL to use the arena
+     * @param flags uint32_t XTEN_PAGE_READ and or XTEN_PAGE_WRITE
+     * @return bool false if the range is not page aligned or the arena is exhausted
+     */
+    bool xten_mapMemory(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t size, uint8_t *host, uint32_t flags)
+    {
+        if ((address & (XTEN_PAGE_SIZE - 1)) != 0 || (size & (XTEN_PAGE_SIZE - 1)) != 0 || size == 0 || (uint64_t)address + size > 0x100000000ULL)
+        {
+            return false;
+        }
+        if (host == NULL)
+        {
+            host = (uint8_t *)xten_arenaAlloc(CPU, size);
+            if (host == NULL)
+            {
+                return false;
+            }
+            memset(host, 0, size);
+        }
+
+        for (uint64_t offset = 0; offset < size; offset += XTEN_PAGE_SIZE)
+        {
+            Xtensa_lx_Page *page = xten_helper_createPage(CPU, address + (uint32_t)offset);
+            if (page == NULL)
+            {
+                return false;
+            }
+            if (page->flags & XTEN_PAGE_CODE)
+            {
+                // the bytes behind cached instructions are changing
+                xten_invalidateCode(CPU, address + (uint32_t)offset, XTEN_PAGE_SIZE);
+            }
+            page->host = host + offset;
+            page->flags = (page->flags & ~(uint32_t)(XTEN_PAGE_READ | XTEN_PAGE_WRITE)) | (flags & (XTEN_PAGE_READ | XTEN_PAGE_WRITE));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Finds the page entry for an address
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose memory map is searched
+     * @param address uint32_t guest address
+     * @return Xtensa_lx_Page pointer or NULL when nothing in that 4MB has been mapped
+     */
+    static inline Xtensa_lx_Page *xten_lookupPage(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_Page *table = CPU->pageDirectory[address >> XTEN_PAGE_TABLE_SHIFT];
+        return (table == NULL) ? NULL : &table[(address >> XTEN_PAGE_SHIFT) & (XTEN_PAGES_PER_TABLE - 1)];
+    }
+
+    /**
+     * @brief Reads one byte going through the memory map or the read callback
+     */
+    static inline uint8_t xten_helper_readByte(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+        if (page != NULL && (page->flags & XTEN_PAGE_READ))
+        {
+            return page->host[address & (XTEN_PAGE_SIZE - 1)];
+        }
+        return (uint8_t)(xten_helper_readCallback(CPU, address) >> 24);
+    }
+
+    /**
+     * @brief Reads one byte for a debugger without touching anything a load would
+     *
+     * Devices are read with CPU->debugRead set and the read is not timed, recorded or replayed so inspecting memory leaves the
+     * guest where it was.
+     */
+    static inline uint8_t xten_helper_debugReadByte(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+        if (page != NULL && (page->flags & XTEN_PAGE_READ))
+        {
+            return page->host[address & (XTEN_PAGE_SIZE - 1)];
+        }
+        CPU->debugRead = true;
+        uint32_t value = xten_helper_busRead(CPU, address);
+        CPU->debugRead = false;
+        return (uint8_t)(value >> 24);
+    }
+
+    /**
+     * @brief Reads 32 bits starting at address from a page that has already been looked up
+     */
+    static inline uint32_t xten_helper_readPage(Xtensa_lx_CPU *CPU, Xtensa_lx_Page *page, uint32_t address)
+    {
+        uint32_t offset = address & (XTEN_PAGE_SIZE - 1);
+        if (page == NULL || !(page->flags & XTEN_PAGE_READ))
+        {
+            return xten_helper_readCallback(CPU, address);
+        }
+        if (offset <= XTEN_PAGE_SIZE - 4)
+        {
+            const uint8_t *bytes = page->host + offset;
+            return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+        }
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            value = (value << 8) | xten_helper_readByte(CPU, address + i);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Reads 32 bits starting at address the same way the MemoryReadCallback does
+     *
+     * Host backed pages are read directly everything else is handed to the read callback. Reads that cross into another page
+     * are put together a byte at a time.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer doing the read
+     * @param address uint32_t guest address
+     * @return uint32_t the byte at address in the most significant bits followed by the next three
+     */
+    static inline uint32_t xten_readMemory(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        return xten_helper_readPage(CPU, xten_lookupPage(CPU, address), address);
+    }
+
+    /**
+     * @brief Writes the low numBytes bytes of value starting at address to a page that has already been looked up
+     */
+    static inline void xten_helper_writePage(Xtensa_lx_CPU *CPU, Xtensa_lx_Page *page, uint32_t address, uint32_t value, int numBytes)
+    {
+        uint32_t offset = address & (XTEN_PAGE_SIZE - 1);
+        if (page != NULL && (page->flags & XTEN_PAGE_WRITE) && offset <= XTEN_PAGE_SIZE - (uint32_t)numBytes)
+        {
+            uint8_t *bytes = page->host + offset;
+            for (int i = 0; i < numBytes; i++)
+            {
+                bytes[i] = (uint8_t)(value >> (8 * (numBytes - 1 - i)));
+            }
+        }
+        else if (page != NULL && (page->flags & (XTEN_PAGE_WRITE | XTEN_PAGE_SNAPSHOT)) && offset > XTEN_PAGE_SIZE - (uint32_t)numBytes)
+        {
+            // crosses into the next page so each byte goes wherever its own page sends it
+            for (int i = 0; i < numBytes; i++)
+            {
+                uint32_t byteAddress = address + (uint32_t)i;
+                xten_helper_writePage(CPU, xten_lookupPage(CPU, byteAddress), byteAddress, (value >> (8 * (numBytes - 1 - i))) & 0xFF, 1);
+            }
+            return;
+        }
+        else if (page != NULL && (page->flags & XTEN_PAGE_SNAPSHOT))
+        {
+            // first store since the snapshot the page is unprotected so later stores take the fast path
+            Xtensa_lx_Snapshot *snapshot = CPU->snapshot;
+            snapshot->dirty[snapshot->dirtyCount++] = page->snapshotIndex;
+            page->flags = (page->flags & ~(uint32_t)XTEN_PAGE_SNAPSHOT) | XTEN_PAGE_WRITE;
+            xten_helper_writePage(CPU, page, address, value, numBytes);
+            return;
+        }
+        else
+        {
+            xten_helper_writeCallback(CPU, address, value, numBytes);
+        }
+        if (page != NULL && (page->flags & XTEN_PAGE_CODE))
+        {
+            // self modifying code or code being copied into IRAM
+            xten_invalidateCode(CPU, address, (uint32_t)numBytes);
+        }
+    }
+
+    /**
+     * @brief Writes the low numBytes bytes of value starting at address
+     *
+     * Writable host backed pages are written directly with the most significant of the written bytes at the lowest address
+     * everything else is handed to the write callback. Writes that start in a writable page and cross into the next one are
+     * put down a byte at a time. Only writes to pages that instructions have been fetched from pay for
+     * invalidating the decode cache.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer doing the write
+     * @param address uint32_t guest address
+     * @param value uint32_t value to write
+     * @param numBytes int 1, 2 or 4
+     */
+    static inline void xten_writeMemory(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes)
+    {
+        xten_helper_writePage(CPU, xten_lookupPage(CPU, address), address, value, numBytes);
+    }
+
+    /**
+     * @brief Checks a load or store against the data breakpoints
+     *
+     * Only called for accesses that already left the fast path. A hit sets DEBUGCAUSE and CPU->stopReason the access itself
+     * still happens and xten_run stops once the instruction finishes.
+     *
+     * @param kind uint32_t XTEN_DBREAKC_LOAD or XTEN_DBREAKC_STORE
+     */
+    static inline void xten_helper_checkWatch(Xtensa_lx_CPU *CPU, uint32_t address, int numBytes, uint32_t kind)
+    {
+        for (uint32_t i = 0; i < XTEN_DBREAK_COUNT; i++)
+        {
+            if (!(CPU->dbreakc[i] & kind))
+            {
+                continue;
+            }
+            uint32_t mask = CPU->dbreakc[i] | ~(uint32_t)XTEN_DBREAKC_MASK;
+            uint32_t start = CPU->dbreaka[i] & mask;
+            // compared as distances from start so ranges that wrap past the top of memory still work
+            if (address - start <= ~mask || start - address < (uint32_t)numBytes)
+            {
+                CPU->debugcause = XTEN_DEBUGCAUSE_DBREAK | (i << XTEN_DEBUGCAUSE_DBNUM_SHIFT);
+                CPU->watchAddress = address;
+                CPU->stopReason = XTEN_STOP_WATCHPOINT;
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Reads memory for a load instruction
+     *
+     * Same as xten_readMemory but accesses to pages flagged XTEN_PAGE_WATCH, pages handled by the callbacks and reads crossing
+     * a page are checked against the data breakpoints. Loads from other pages cost the same as without data breakpoints.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer doing the load
+     * @param address uint32_t guest address
+     * @param numBytes int bytes the instruction uses 1, 2 or 4
+     * @return uint32_t the byte at address in the most significant bits followed by the next three
+     */
+    static inline uint32_t xten_loadMemory(Xtensa_lx_CPU *CPU, uint32_t address, int numBytes)
+    {
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+        uint32_t offset = address & (XTEN_PAGE_SIZE - 1);
+        if (page != NULL && (page->flags & (XTEN_PAGE_READ | XTEN_PAGE_WATCH)) == XTEN_PAGE_READ && offset <= XTEN_PAGE_SIZE - 4)
+        {
+            const uint8_t *bytes = page->host + offset;
+            return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+        }
+        xten_helper_checkWatch(CPU, address, numBytes, XTEN_DBREAKC_LOAD);
+        return xten_helper_readPage(CPU, page, address);
+    }
+
+    /**
+     * @brief Reads the host memory bytes an access covers without going to the callbacks
+     *
+     * Bytes the callbacks handle read as 0. The byte at address ends up in the most significant of the numBytes bytes.
+     */
+    static inline uint32_t xten_helper_hostBytes(Xtensa_lx_CPU *CPU, uint32_t address, int numBytes)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < numBytes; i++)
+        {
+            Xtensa_lx_Page *page = xten_lookupPage(CPU, address + i);
+            value <<= 8;
+            if (page != NULL && page->host != NULL)
+            {
+                value |= page->host[(address + i) & (XTEN_PAGE_SIZE - 1)];
+            }
+        }
+        return value;
+    }
+
+    /**
+     * @brief Writes memory for a store instruction
+     *
+     * Same as xten_writeMemory but stores that leave the fast path are checked against the data breakpoints first.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer doing the store
+     * @param address uint32_t guest address
+     * @param value uint32_t value to write
+     * @param numBytes int 1, 2 or 4
+     */
+    static inline void xten_storeMemory(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes)
+    {
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+        uint32_t offset = address & (XTEN_PAGE_SIZE - 1);
+        if (page == NULL || (page->flags & (XTEN_PAGE_WRITE | XTEN_PAGE_WATCH)) != XTEN_PAGE_WRITE || offset > XTEN_PAGE_SIZE - (uint32_t)numBytes)
+        {
+            xten_helper_checkWatch(CPU, address, numBytes, XTEN_DBREAKC_STORE);
+        }
+        if (CPU->accessLog != NULL)
+        {
+            xten_helper_logAccess(CPU->accessLog->writes, &CPU->accessLog->writeCount, address, value,
+                                  xten_helper_hostBytes(CPU, address, numBytes), numBytes);
+        }
+        xten_helper_writePage(CPU, page, address, value, numBytes);
+    }
+
+    /**
+     * @brief Checks whether every byte of an access can be read from host memory without side effects
+     */
+    static inline bool xten_helper_hostReadable(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t length)
+    {
+        Xtensa_lx_Page *first = xten_lookupPage(CPU, address);
+        Xtensa_lx_Page *last = xten_lookupPage(CPU, address + length - 1);
+        return first != NULL && last != NULL && (first->flags & XTEN_PAGE_READ) && (last->flags & XTEN_PAGE_READ);
+    }
+
+    /****************************************This section is for the bus**************************************************************/
+
+    /**
+     * @brief Finds the device whose range holds an address
+     *
+     * The table is kept sorted by start address and ranges never overlap so a binary search for the last range starting at or
+     * below the address is enough.
+     *
+     * @return Xtensa_lx_BusDevice pointer or NULL when no device covers the address
+     */
+    static inline Xtensa_lx_BusDevice *xten_helper_findDevice(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        uint32_t low = 0;
+        uint32_t high = CPU->busDeviceCount;
+        while (low < high)
+        {
+            uint32_t middle = (low + high) / 2;
+            if (CPU->busDevices[middle].start <= address)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        if (low == 0 || CPU->busDevices[low - 1].last < address)
+        {
+            return NULL;
+        }
+        return &CPU->busDevices[low - 1];
+    }
+
+    /**
+     * @brief Sets XTEN_PAGE_MMIO on the pages of a range that still hold a device and clears it on the rest
+     */
+    static inline bool xten_helper_refreshBusPages(Xtensa_lx_CPU *CPU, uint32_t start, uint32_t last)
+    {
+        for (uint64_t address = start & ~(uint32_t)(XTEN_PAGE_SIZE - 1); address <= last; address += XTEN_PAGE_SIZE)
+        {
+            Xtensa_lx_Page *page = xten_helper_createPage(CPU, (uint32_t)address);
+            if (page == NULL)
+            {
+                return false;
+            }
+            uint32_t pageLast = (uint32_t)address + XTEN_PAGE_SIZE - 1;
+            bool covered = false;
+            for (uint32_t i = 0; i < CPU->busDeviceCount && !covered; i++)
+            {
+                covered = CPU->busDevices[i].start <= pageLast && CPU->busDevices[i].last >= address;
+            }
+            if (page->flags & XTEN_PAGE_CODE)
+            {
+                // instructions fetched through the callbacks may now come from a device or the other way round
+                xten_invalidateCode(CPU, (uint32_t)address, XTEN_PAGE_SIZE);
+            }
+            page->flags = covered ? (page->flags | XTEN_PAGE_MMIO) : (page->flags & ~(uint32_t)XTEN_PAGE_MMIO);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Puts a device model on the bus
+     *
+     * Loads, stores and fetches in the range that the memory map does not handle go to the device instead of the
+     * MemoryReadCallback and MemoryWriteCallback. Only pages holding a device pay for the lookup everything else goes straight
+     * to the callbacks as before. The range does not have to be page aligned so several devices can share a page but it cannot
+     * be on a page mapped with xten_mapMemory because host backed pages never leave the fast path. Device accesses are
+     * recorded and replayed like callback reads.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose bus gets the device
+     * @param address uint32_t first guest address of the range
+     * @param size uint32_t bytes in the range
+     * @param read DeviceReadCallback for loads and fetches or NULL
+     * @param write DeviceWriteCallback for stores or NULL
+     * @param device pointer handed back to read and write
+     * @return bool false if the range is empty, wraps, overlaps another device or a host backed page or the table is full
+     */
+    bool xten_mapDevice(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t size, DeviceReadCallback read, DeviceWriteCallback write, void *device)
+    {
+        if (size == 0 || (uint64_t)address + size > 0x100000000ULL || CPU->busDeviceCount == XTEN_MAX_BUS_DEVICES)
+        {
+            return false;
+        }
+        uint32_t last = address + (size - 1);
+        for (uint64_t page = address & ~(uint32_t)(XTEN_PAGE_SIZE - 1); page <= last; page += XTEN_PAGE_SIZE)
+        {
+            Xtensa_lx_Page *entry = xten_lookupPage(CPU, (uint32_t)page);
+            if (entry != NULL && (entry->flags & (XTEN_PAGE_READ | XTEN_PAGE_WRITE | XTEN_PAGE_SNAPSHOT)))
+            {
+                return false;
+            }
+        }
+        uint32_t index = 0;
+        while (index < CPU->busDeviceCount && CPU->busDevices[index].start <= address)
+        {
+            index++;
+        }
+        if ((index > 0 && CPU->busDevices[index - 1].last >= address) || (index < CPU->busDeviceCount && CPU->busDevices[index].start <= last))
+        {
+            return false;
+        }
+        memmove(&CPU->busDevices[index + 1], &CPU->busDevices[index], (CPU->busDeviceCount - index) * sizeof(Xtensa_lx_BusDevice));
+        CPU->busDevices[index] = (Xtensa_lx_BusDevice){address, last, read, write, device};
+        CPU->busDeviceCount++;
+        return xten_helper_refreshBusPages(CPU, address, last);
+    }
+
+    /**
+     * @brief Takes the device whose range starts at address off the bus
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose bus has the device
+     * @param address uint32_t start address the device was mapped at
+     * @return bool false if no device starts there
+     */
+    bool xten_unmapDevice(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_BusDevice *device = xten_helper_findDevice(CPU, address);
+        if (device == NULL || device->start != address)
+        {
+            return false;
+        }
+        uint32_t last = device->last;
+        uint32_t index = (uint32_t)(device - CPU->busDevices);
+        memmove(device, device + 1, (CPU->busDeviceCount - index - 1) * sizeof(Xtensa_lx_BusDevice));
+        CPU->busDeviceCount--;
+        return xten_helper_refreshBusPages(CPU, address, last);
+    }
+
+    /**
+     * @brief Hands a read the memory map missed to the device covering it or the MemoryReadCallback
+     */
+    static inline uint32_t xten_helper_busRead(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+        if (page != NULL && (page->flags & XTEN_PAGE_MMIO))
+        {
+            Xtensa_lx_BusDevice *device = xten_helper_findDevice(CPU, address);
+            if (device != NULL)
+            {
+                return (device->read == NULL) ? 0 : device->read(CPU, address - device->start, device->device);
+            }
+        }
+        return CPU->readMemory(CPU, address, CPU->callbackContext);
+    }
+
+    /**
+     * @brief Hands a write the memory map missed to the device covering it or the MemoryWriteCallback
+     */
+    static inline void xten_helper_busWrite(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes)
+    {
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+        if (page != NULL && (page->flags & XTEN_PAGE_MMIO))
+        {
+            Xtensa_lx_BusDevice *device = xten_helper_findDevice(CPU, address);
+            if (device != NULL)
+            {
+                if (device->write != NULL)
+                {
+                    device->write(CPU, address - device->start, value, numBytes, device->device);
+                }
+                return;
+            }
+        }
+        CPU->writeMemory(CPU, address, value, numBytes, CPU->callbackContext);
+    }
+
+    /**
+     * @brief Copies guest memory into a host buffer
+     *
+     * Host backed pages are copied a page at a time everything else a byte at a time through the callbacks. Data breakpoints
+     * are not checked. Meant for host code that works on guest buffers such as native functions.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose memory is read
+     * @param host buffer of at least length bytes
+     * @param address uint32_t first guest address
+     * @param length uint32_t bytes to copy
+     */
+    void xten_readBlock(Xtensa_lx_CPU *CPU, void *host, uint32_t address, uint32_t length)
+    {
+        uint8_t *bytes = (uint8_t *)host;
+        while (length != 0)
+        {
+            Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+            uint32_t offset = address & (XTEN_PAGE_SIZE - 1);
+            uint32_t chunk = (length < XTEN_PAGE_SIZE - offset) ? length : XTEN_PAGE_SIZE - offset;
+            if (page != NULL && (page->flags & XTEN_PAGE_READ))
+            {
+                memcpy(bytes, page->host + offset, chunk);
+            }
+            else
+            {
+                for (uint32_t i = 0; i < chunk; i++)
+                {
+                    bytes[i] = xten_helper_readByte(CPU, address + i);
+                }
+            }
+            bytes += chunk;
+            address += chunk;
+            length -= chunk;
+        }
+    }
+
+    /**
+     * @brief Copies a host buffer into guest memory
+     *
+     * The counterpart of xten_readBlock. Snapshots and the decode cache see the write the same way they see stores.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose memory is written
+     * @param address uint32_t first guest address
+     * @param host buffer of at least length bytes
+     * @param length uint32_t bytes to copy
+     */
+    void xten_writeBlock(Xtensa_lx_CPU *CPU, uint32_t address, const void *host, uint32_t length)
+    {
+        const uint8_t *bytes = (const uint8_t *)host;
+        while (length != 0)
+        {
+            Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+            uint32_t offset = address & (XTEN_PAGE_SIZE - 1);
+            uint32_t chunk = (length < XTEN_PAGE_SIZE - offset) ? length : XTEN_PAGE_SIZE - offset;
+            if (page != NULL && (page->flags & XTEN_PAGE_SNAPSHOT))
+            {
+                xten_helper_writePage(CPU, page, address, bytes[0], 1); // marks the page dirty and writable
+            }
+            if (page != NULL && (page->flags & XTEN_PAGE_WRITE))
+            {
+                memcpy(page->host + offset, bytes, chunk);
+                if (page->flags & XTEN_PAGE_CODE)
+                {
+                    xten_invalidateCode(CPU, address, chunk);
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0; i < chunk; i++)
+                {
+                    xten_helper_writePage(CPU, page, address + i, bytes[i], 1);
+                }
+            }
+            bytes += chunk;
+            address += chunk;
+            length -= chunk;
+        }
+    }
+
+    /**
+     * @brief Copies guest memory to guest memory handling overlap the way memmove does
+     */
+    void xten_moveBlock(Xtensa_lx_CPU *CPU, uint32_t destination, uint32_t source, uint32_t length)
+    {
+        uint8_t chunk[XTEN_NATIVE_CHUNK];
+        bool backwards = destination > source && destination - source < length;
+        for (uint32_t done = 0; done < length;)
+        {
+            uint32_t size = (length - done < XTEN_NATIVE_CHUNK) ? length - done : XTEN_NATIVE_CHUNK;
+            uint32_t offset = backwards ? length - done - size : done;
+            xten_readBlock(CPU, chunk, source + offset, size);
+            xten_writeBlock(CPU, destination + offset, chunk, size);
+            done += size;
+        }
+    }
+
+    /**
+     * @brief Sets length bytes of guest memory to value
+     */
+    void xten_fillBlock(Xtensa_lx_CPU *CPU, uint32_t destination, uint8_t value, uint32_t length)
+    {
+        uint8_t chunk[XTEN_NATIVE_CHUNK];
+        memset(chunk, value, sizeof(chunk));
+        for (uint32_t done = 0; done < length;)
+        {
+            uint32_t size = (length - done < XTEN_NATIVE_CHUNK) ? length - done : XTEN_NATIVE_CHUNK;
+            xten_writeBlock(CPU, destination + done, chunk, size);
+            done += size;
+        }
+    }
+
+    /**
+     * @brief Compares guest memory the way memcmp does
+     *
+     * @return int32_t difference of the first pair of bytes that differ or 0
+     */
+    int32_t xten_compareBlock(Xtensa_lx_CPU *CPU, uint32_t first, uint32_t second, uint32_t length)
+    {
+        uint8_t left[XTEN_NATIVE_CHUNK];
+        uint8_t right[XTEN_NATIVE_CHUNK];
+        for (uint32_t done = 0; done < length;)
+        {
+            uint32_t size = (length - done < XTEN_NATIVE_CHUNK) ? length - done : XTEN_NATIVE_CHUNK;
+            xten_readBlock(CPU, left, first + done, size);
+            xten_readBlock(CPU, right, second + done, size);
+            for (uint32_t i = 0; i < size; i++)
+            {
+                if (left[i] != right[i])
+                {
+                    return (int32_t)left[i] - (int32_t)right[i];
+                }
+            }
+            done += size;
+        }
+        return 0;
+    }
+
+    /****************************************This section is for snapshots**************************************************************/
+
+    /**
+     * @brief Saves the registers and every host backed writable page of a CPU
+     *
+     * Restoring only copies back the pages stored to since the snapshot was taken or last restored so resetting after a short
+     * run costs about as much as the run touched. A CPU can have one snapshot at a time. Mapping memory while a snapshot is
+     * active is not supported.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to save
+     * @return Xtensa_lx_Snapshot pointer or NULL if the CPU already has a snapshot or allocation fails
+     */
+    Xtensa_lx_Snapshot *xten_takeSnapshot(Xtensa_lx_CPU *CPU)
+    {
+        if (CPU->snapshot != NULL)
+        {
+            return NULL;
+        }
+        uint32_t pageCount = 0;
+        for (uint32_t i = 0; i < XTEN_PAGE_DIRECTORY_SIZE; i++)
+        {
+            for (uint32_t j = 0; CPU->pageDirectory[i] != NULL && j < XTEN_PAGES_PER_TABLE; j++)
+            {
+                pageCount += (CPU->pageDirectory[i][j].flags & XTEN_PAGE_WRITE) ? 1 : 0;
+            }
+        }
+
+        Xtensa_lx_Snapshot *snapshot = (Xtensa_lx_Snapshot *)calloc(1, sizeof(Xtensa_lx_Snapshot));
+        if (snapshot == NULL)
+        {
+            return NULL;
+        }
+        snapshot->pageAddresses = (uint32_t *)malloc(pageCount * sizeof(uint32_t) + 1); // one extra byte so a snapshot with no pages is not NULL
+        snapshot->pages = (Xtensa_lx_Page **)malloc(pageCount * sizeof(Xtensa_lx_Page *) + 1);
+        snapshot->pageData = (uint8_t *)malloc((size_t)pageCount * XTEN_PAGE_SIZE + 1);
+        snapshot->dirty = (uint32_t *)malloc(pageCount * sizeof(uint32_t) + 1);
+        if (snapshot->pageAddresses == NULL || snapshot->pages == NULL || snapshot->pageData == NULL || snapshot->dirty == NULL)
+        {
+            free(snapshot->pageAddresses);
+            free(snapshot->pages);
+            free(snapshot->pageData);
+            free(snapshot->dirty);
+            free(snapshot);
+            return NULL;
+        }
+
+        snapshot->CPU = CPU;
+        for (uint32_t i = 0; i < XTEN_PAGE_DIRECTORY_SIZE; i++)
+        {
+            for (uint32_t j = 0; CPU->pageDirectory[i] != NULL && j < XTEN_PAGES_PER_TABLE; j++)
+            {
+                Xtensa_lx_Page *page = &CPU->pageDirectory[i][j];
+                if (page->flags & XTEN_PAGE_WRITE)
+                {
+                    uint32_t index = snapshot->pageCount++;
+                    snapshot->pageAddresses[index] = (i << XTEN_PAGE_TABLE_SHIFT) | (j << XTEN_PAGE_SHIFT);
+                    snapshot->pages[index] = page;
+                    memcpy(snapshot->pageData + (size_t)index * XTEN_PAGE_SIZE, page->host, XTEN_PAGE_SIZE);
+                    page->snapshotIndex = index;
+                    page->flags = (page->flags & ~(uint32_t)XTEN_PAGE_WRITE) | XTEN_PAGE_SNAPSHOT;
+                }
+            }
+        }
+
+        memcpy(snapshot->registers, CPU->registerStorage, sizeof(snapshot->registers));
+        snapshot->PC = CPU->PC;
+        snapshot->sar = CPU->sar;
+        snapshot->windowOffset = CPU->windowOffset;
+        snapshot->ccount = CPU->ccount;
+        snapshot->interrupt = CPU->interrupt;
+        snapshot->intenable = CPU->intenable;
+        snapshot->exccause = CPU->exccause;
+        snapshot->excvaddr = CPU->excvaddr;
+        snapshot->epc1 = CPU->epc1;
+        snapshot->debugcause = CPU->debugcause;
+        memcpy(snapshot->userRegisters, CPU->userRegisters, sizeof(snapshot->userRegisters));
+        CPU->snapshot = snapshot;
+        return snapshot;
+    }
+
+    /**
+     * @brief Puts a CPU back the way it was when the snapshot was taken
+     *
+     * @param *snapshot Xtensa_lx_Snapshot pointer from xten_takeSnapshot
+     */
+    void xten_restoreSnapshot(Xtensa_lx_Snapshot *snapshot)
+    {
+        Xtensa_lx_CPU *CPU = snapshot->CPU;
+        for (uint32_t i = 0; i < snapshot->dirtyCount; i++)
+        {
+            uint32_t index = snapshot->dirty[i];
+            Xtensa_lx_Page *page = snapshot->pages[index];
+            memcpy(page->host, snapshot->pageData + (size_t)index * XTEN_PAGE_SIZE, XTEN_PAGE_SIZE);
+            page->flags = (page->flags & ~(uint32_t)XTEN_PAGE_WRITE) | XTEN_PAGE_SNAPSHOT;
+            if (page->flags & XTEN_PAGE_CODE)
+            {
+                xten_invalidateCode(CPU, snapshot->pageAddresses[index], XTEN_PAGE_SIZE);
+            }
+        }
+        snapshot->dirtyCount = 0;
+
+        memcpy(CPU->registerStorage, snapshot->registers, sizeof(snapshot->registers));
+        CPU->PC = snapshot->PC;
+        CPU->sar = snapshot->sar;
+        CPU->windowOffset = snapshot->windowOffset;
+        CPU->ccount = snapshot->ccount;
+        CPU->interrupt = snapshot->interrupt;
+        CPU->intenable = snapshot->intenable;
+        CPU->exccause = snapshot->exccause;
+        CPU->excvaddr = snapshot->excvaddr;
+        CPU->epc1 = snapshot->epc1;
+        CPU->debugcause = snapshot->debugcause;
+        memcpy(CPU->userRegisters, snapshot->userRegisters, sizeof(snapshot->userRegisters));
+        CPU->addressLines = CPU->PC;
+        CPU->chipEnable = XTEN_HIGH;
+        CPU->write = XTEN_LOW;
+        CPU->stopReason = XTEN_STOP_NONE;
+        CPU->breakStopped = false;
+    }
+
+    /**
+     * @brief Stops tracking pages for a snapshot and frees it
+     *
+     * @param *snapshot Xtensa_lx_Snapshot pointer from xten_takeSnapshot the CPU keeps its current state
+     */
+    void xten_freeSnapshot(Xtensa_lx_Snapshot *snapshot)
+    {
+        if (snapshot == NULL)
+        {
+            return;
+        }
+        for (uint32_t i = 0; i < snapshot->pageCount; i++)
+        {
+            Xtensa_lx_Page *page = snapshot->pages[i];
+            if (page->flags & XTEN_PAGE_SNAPSHOT)
+            {
+                page->flags = (page->flags & ~(uint32_t)XTEN_PAGE_SNAPSHOT) | XTEN_PAGE_WRITE;
+            }
+        }
+        snapshot->CPU->snapshot = NULL;
+        free(snapshot->pageAddresses);
+        free(snapshot->pages);
+        free(snapshot->pageData);
+        free(snapshot->dirty);
+        free(snapshot);
+    }
+
+    /****************************************This section is for record and replay**************************************************************/
+
+    /**
+     * @brief writes a uint32_t as 4 little-endian bytes
+     */
+    static inline bool xten_helper_writeLE32(FILE *file, uint32_t value)
+    {
+        uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+        return fwrite(bytes, 1, 4, file) == 4;
+    }
+
+    /**
+     * @brief reads 4 little-endian bytes into a uint32_t
+     */
+    static inline bool xten_helper_readLE32(FILE *file, uint32_t *value)
+    {
+        uint8_t bytes[4];
+        if (fread(bytes, 1, 4, file) != 4)
+        {
+            return false;
+        }
+        *value = (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+        return true;
+    }
+
+    static inline void xten_helper_recordEvent(Xtensa_lx_CPU *CPU, uint32_t kind, uint32_t address, uint32_t value)
+    {
+        xten_helper_writeLE32(CPU->recordFile, kind);
+        xten_helper_writeLE32(CPU->recordFile, CPU->ccount);
+        xten_helper_writeLE32(CPU->recordFile, address);
+        xten_helper_writeLE32(CPU->recordFile, value);
+    }
+
+    static inline void xten_helper_nextReplayEvent(Xtensa_lx_CPU *CPU)
+    {
+        Xtensa_lx_ReplayEvent *event = &CPU->replayEvent;
+        CPU->replayHasEvent = xten_helper_readLE32(CPU->replayFile, &event->kind) && xten_helper_readLE32(CPU->replayFile, &event->ccount) &&
+                              xten_helper_readLE32(CPU->replayFile, &event->address) && xten_helper_readLE32(CPU->replayFile, &event->value);
+    }
+
+    /**
+     * @brief Starts logging every input that comes from outside the CPU
+     *
+     * Every value returned by the read callback (the memory map is not logged since it is the CPU's own state) and every
+     * interrupt injected with xten_injectInterrupt is written to file with the CCOUNT it happened at. The file is written as
+     * execution goes so it should be opened in binary mode and is flushed by xten_stopRecording.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to record
+     * @param file FILE pointer opened for writing
+     * @return bool false if the header could not be written
+     */
+    bool xten_startRecording(Xtensa_lx_CPU *CPU, FILE *file)
+    {
+        if (file == NULL || !xten_helper_writeLE32(file, XTEN_REPLAY_MAGIC) || !xten_helper_writeLE32(file, XTEN_REPLAY_VERSION))
+        {
+            return false;
+        }
+        CPU->recordFile = file;
+        return true;
+    }
+
+    void xten_stopRecording(Xtensa_lx_CPU *CPU)
+    {
+        if (CPU->recordFile != NULL)
+        {
+            fflush(CPU->recordFile);
+            CPU->recordFile = NULL;
+        }
+    }
+
+    /**
+     * @brief Starts feeding a recording back into the CPU
+     *
+     * While replaying the read and write callbacks are never called reads that miss the memory map return the recorded values
+     * and writes are dropped so none of the user's device models run. Recorded interrupts are injected at the CCOUNT they were
+     * recorded at and xten_injectInterrupt is ignored. The CPU should be in the same state it was when recording started.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to replay into
+     * @param file FILE pointer to a recording opened for reading
+     * @return bool false if the file is not a recording this version understands
+     */
+    bool xten_startReplay(Xtensa_lx_CPU *CPU, FILE *file)
+    {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        if (file == NULL || !xten_helper_readLE32(file, &magic) || !xten_helper_readLE32(file, &version) || magic != XTEN_REPLAY_MAGIC ||
+            version != XTEN_REPLAY_VERSION)
+        {
+            return false;
+        }
+        CPU->replayFile = file;
+        CPU->replayDiverged = false;
+        xten_helper_nextReplayEvent(CPU);
+        return true;
+    }
+
+    void xten_stopReplay(Xtensa_lx_CPU *CPU)
+    {
+        CPU->replayFile = NULL;
+        CPU->replayHasEvent = false;
+    }
+
+    /**
+     * @brief Reports whether a replay stopped matching its recording
+     *
+     * @param *CPU Xtensa_lx_CPU pointer being replayed
+     * @return bool true once a read happened that was not the next recorded read
+     */
+    bool xten_replayDiverged(Xtensa_lx_CPU *CPU)
+    {
+        return CPU->replayDiverged;
+    }
+
+    /**
+     * @brief Raises interrupt request bits from outside the CPU
+     *
+     * The bits are ORed into the INTERRUPT special register which guest code can read with RSR.INTERRUPT. They are logged when
+     * recording and ignored when replaying since the recording provides them then.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to interrupt
+     * @param mask uint32_t interrupt bits to raise
+     */
+    void xten_injectInterrupt(Xtensa_lx_CPU *CPU, uint32_t mask)
+    {
+        if (CPU->replayFile != NULL)
+        {
+            return;
+        }
+        if (CPU->recordFile != NULL)
+        {
+            xten_helper_recordEvent(CPU, XTEN_EVENT_INTERRUPT, 0, mask);
+        }
+        CPU->interrupt |= mask;
+    }
+
+    /**
+     * @brief Delivers recorded interrupts whose CCOUNT has been reached
+     */
+    static inline void xten_helper_replayInterrupts(Xtensa_lx_CPU *CPU)
+    {
+        while (CPU->replayHasEvent && CPU->replayEvent.kind == XTEN_EVENT_INTERRUPT && (int32_t)(CPU->ccount - CPU->replayEvent.ccount) >= 0)
+        {
+            CPU->interrupt |= CPU->replayEvent.value;
+            xten_helper_nextReplayEvent(CPU);
+        }
+    }
+
+    /**
+     * @brief Every read that misses the memory map goes through here so it can be recorded or replayed
+     */
+    static inline uint32_t xten_helper_readCallback(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        CPU->ccount += CPU->timing.mmioWait;
+        if (CPU->replayFile != NULL)
+        {
+            xten_helper_replayInterrupts(CPU);
+            if (!CPU->replayHasEvent || CPU->replayEvent.kind != XTEN_EVENT_READ || CPU->replayEvent.address != address)
+            {
+                CPU->replayDiverged = true;
+                return 0;
+            }
+            uint32_t value = CPU->replayEvent.value;
+            xten_helper_nextReplayEvent(CPU);
+            return value;
+        }
+        uint32_t value = xten_helper_busRead(CPU, address);
+        if (CPU->recordFile != NULL)
+        {
+            xten_helper_recordEvent(CPU, XTEN_EVENT_READ, address, value);
+        }
+        if (CPU->accessLog != NULL)
+        {
+            xten_helper_logAccess(CPU->accessLog->reads, &CPU->accessLog->readCount, address, value, 0, 4);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Every write that misses the memory map goes through here so replays can keep it away from the device models
+     */
+    static inline void xten_helper_writeCallback(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes)
+    {
+        CPU->ccount += CPU->timing.mmioWait;
+        if (CPU->replayFile == NULL)
+        {
+            xten_helper_busWrite(CPU, address, value, numBytes);
+        }
+    }
+
+    /****************************************This section is for the decode cache**************************************************************/
+
+    /**
+     * @brief Invalidates cached instructions that overlap a range of guest addresses
+     *
+     * Only the entries for instructions that start in the range or close enough before it to overlap it are touched so a store
+     * into a code page does not throw away the rest of the cache. Superinstructions reach up to XTEN_FUSE_MAX_INSTRUCTIONS
+     * instructions so entries that far back are included. Users that change guest code behind the CPU's back (DMA,
+     * loading a new image) should call this for the range they changed.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose caches are invalidated
+     * @param address uint32_t first guest address that changed
+     * @param length uint32_t number of bytes that changed
+     */
+    static inline void xten_invalidateCode(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t length)
+    {
+        if (CPU->decodeCache == NULL || length == 0)
+        {
+            return;
+        }
+        if (length >= XTEN_DECODE_CACHE_SIZE)
+        {
+            CPU->generation++; // every slot would be looked at anyway
+            return;
+        }
+#ifdef XTEN_ENABLE_JIT
+        if (CPU->jit != NULL)
+        {
+            CPU->generation++; // translated blocks do not record which addresses they were made from
+            return;
+        }
+#endif
+        uint32_t first = address - (XTEN_FUSE_MAX_INSTRUCTIONS * XTEN_MAX_INSTRUCTION_SIZE - 1);
+        uint32_t count = length + XTEN_FUSE_MAX_INSTRUCTIONS * XTEN_MAX_INSTRUCTION_SIZE - 1;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Xtensa_lx_DecodeEntry *entry = &CPU->decodeCache[(first + i) & (XTEN_DECODE_CACHE_SIZE - 1)];
+            if (entry->pc == first + i)
+            {
+                entry->generation = CPU->generation - 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Invalidates every cached instruction
+     *
+     * Used by ISYNC which is the point where the ISA guarantees stores to instruction memory are seen by instruction fetch and
+     * therefore also covers code written through the write callback where the CPU cannot see the bytes change.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose caches are invalidated
+     */
+    static inline void xten_invalidateAllCode(Xtensa_lx_CPU *CPU)
+    {
+        CPU->generation++;
+    }
+
+    /**
+     * @brief Checks whether execution should stop before the instruction at an address
+     *
+     * This is only called when a decode entry is filled for a page flagged XTEN_PAGE_BREAK so running code never compares the
+     * program counter against the breakpoints.
+     */
+    static inline bool xten_helper_isBreakpoint(Xtensa_lx_CPU *CPU, uint32_t pc)
+    {
+        for (uint32_t i = 0; i < CPU->breakpointCount; i++)
+        {
+            if (CPU->breakpoints[i] == pc)
+            {
+                return true;
+            }
+        }
+        for (uint32_t i = 0; i < XTEN_IBREAK_COUNT; i++)
+        {
+            if ((CPU->ibreakenable & (1U << i)) && CPU->ibreaka[i] == pc)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks whether an opcode is a jump, call, return or branch
+     *
+     * Covers CALLN, SI and B where the core jumps, calls and branches live and the CALLX group of ST0 holding RET, JX and
+     * CALLX. Anything else in those groups just ends up counted as an edge to the next instruction.
+     */
+    static inline bool xten_helper_isControlFlow(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0x0F;
+        uint32_t op1 = (opcode >> (CPU->msbFirstOption ? 4 : 16)) & 0x0F;
+        uint32_t op2 = (opcode >> (CPU->msbFirstOption ? 0 : 20)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        return op0 == 0x5 || op0 == 0x6 || op0 == 0x7 || (op0 == 0x0 && op1 == 0x0 && op2 == 0x0 && r == 0x0);
+    }
+
+    /**
+     * @brief Decodes an opcode with the tables generated from Helper Code/xtensa_core.isa
+     *
+     * One lookup on op0, op1, op2 and r gives the instruction or for the few groups that need more bits a secondary table
+     * picked by s, t or m and n. The result routes every opcode to the same handler xten_decodeOp0 would.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer whose byte order the fields are taken with
+     * @param opcode uint32_t 24 bit opcode
+     * @return uint32_t XTEN_OP_* of the instruction XTEN_OP_ILLEGAL when nothing matches
+     */
+    static inline uint32_t xten_decodeInstruction(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0x0F;
+        uint32_t op1 = (opcode >> (CPU->msbFirstOption ? 4 : 16)) & 0x0F;
+        uint32_t op2 = (opcode >> (CPU->msbFirstOption ? 0 : 20)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        uint32_t op = xten_decodePrimary[op0 | (op1 << 4) | (op2 << 8) | (r << 12)];
+        if (op & XTEN_DECODE_SECONDARY)
+        {
+            uint32_t table = op & ~XTEN_DECODE_SECONDARY;
+            uint32_t key;
+            switch (xten_decodeSelect[table])
+            {
+            case XTEN_SELECT_S:
+                key = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+                break;
+            case XTEN_SELECT_T:
+                key = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+                break;
+            default:
+                key = (((opcode >> (CPU->msbFirstOption ? 16 : 6)) & 0x03) << 2) | ((opcode >> (CPU->msbFirstOption ? 18 : 4)) & 0x03);
+                break;
+            }
+            op = xten_decodeSecondary[table][key];
+        }
+        return op;
+    }
+
+    /**
+     * @brief Checks whether the instruction count instructions after pc can join a superinstruction and reads its opcode
+     *
+     * Only host memory is looked at so peeking ahead never calls the read callback and an instruction with a breakpoint on it
+     * has to start its own dispatch. The page it is on is flagged XTEN_PAGE_CODE so stores to it invalidate the entry at pc.
+     */
+    static inline bool xten_helper_fuseNext(Xtensa_lx_CPU *CPU, uint32_t pc, uint32_t count, uint32_t *opcode, uint32_t *op)
+    {
+        uint32_t address = pc + count * XTEN_MAX_INSTRUCTION_SIZE;
+        if (!xten_helper_hostReadable(CPU, address, XTEN_MAX_INSTRUCTION_SIZE))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < XTEN_MAX_INSTRUCTION_SIZE; i += XTEN_MAX_INSTRUCTION_SIZE - 1)
+        {
+            Xtensa_lx_Page *page = xten_lookupPage(CPU, address + i);
+            page->flags |= XTEN_PAGE_CODE;
+            if (i == 0 && (page->flags & XTEN_PAGE_BREAK) && xten_helper_isBreakpoint(CPU, address))
+            {
+                return false;
+            }
+        }
+        *opcode = xten_readMemory(CPU, address) >> 8;
+        *op = xten_decodeInstruction(CPU, *opcode);
+        return true;
+    }
+
+    /**
+     * @brief Looks for a common idiom starting at a freshly filled entry and makes it a superinstruction
+     *
+     * The instructions still run through their own handlers one after the other so a superinstruction only saves the fetch
+     * and dispatch in between. Nothing is fused while coverage, the fetch cache model or the timing model is on because every
+     * edge has to be counted on its own or with XTEN_ENABLE_STATS so every instruction is counted under its own name.
+     */
+    static inline void xten_helper_fuseEntry(Xtensa_lx_CPU *CPU, Xtensa_lx_DecodeEntry *entry, uint32_t pc)
+    {
+        entry->dispatch = entry->op;
+#ifdef XTEN_ENABLE_STATS
+        return;
+#endif
+        if (CPU->coverageMap != NULL || CPU->fetchCache != NULL || CPU->timingEnabled)
+        {
+            return;
+        }
+        uint32_t opcode = entry->opcode;
+        uint32_t nextOpcode;
+        uint32_t nextOp;
+        if ((entry->op != XTEN_OP_L32R && entry->op != XTEN_OP_MOVI && entry->op != XTEN_OP_EXTUI && entry->op != XTEN_OP_L32I) ||
+            !xten_helper_fuseNext(CPU, pc, 1, &nextOpcode, &nextOp))
+        {
+            return;
+        }
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        uint32_t nextS = (nextOpcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t nextT = (nextOpcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        bool nextBranch = xten_opFamilies[nextOp] == XTEN_FAMILY_CONDITIONAL_BRANCH;
+        entry->fusedOpcodes[0] = nextOpcode;
+        entry->fusedOpcodes[1] = 0;
+        entry->fusedOps[0] = (uint8_t)nextOp;
+        entry->fusedOps[1] = XTEN_OP_ILLEGAL;
+        switch (entry->op)
+        {
+        case XTEN_OP_L32R:
+            // L32R a, literal then CALLX0 a
+            if (nextOp == XTEN_OP_CALLX0 && nextS == t)
+            {
+                entry->dispatch = XTEN_FUSED_L32R_CALLX0;
+            }
+            break;
+        case XTEN_OP_MOVI:
+            if (nextBranch && (nextS == t || nextT == t))
+            {
+                entry->dispatch = XTEN_FUSED_MOVI_BRANCH;
+            }
+            break;
+        case XTEN_OP_EXTUI:
+            // EXTUI writes AR[r]
+            if (nextBranch && (nextS == r || nextT == r))
+            {
+                entry->dispatch = XTEN_FUSED_EXTUI_BRANCH;
+            }
+            break;
+        case XTEN_OP_L32I:
+        {
+            // L32I a, b, offset then ADDI a, a, step then S32I a, b, offset
+            uint32_t lastOpcode;
+            uint32_t lastOp;
+            if (nextOp == XTEN_OP_ADDI && nextS == t && nextT == t && xten_helper_fuseNext(CPU, pc, 2, &lastOpcode, &lastOp) &&
+                lastOp == XTEN_OP_S32I && ((lastOpcode ^ opcode) & (CPU->msbFirstOption ? 0x0FF0FF : 0xFF0FF0)) == 0)
+            {
+                entry->fusedOpcodes[1] = lastOpcode;
+                entry->fusedOps[1] = (uint8_t)lastOp;
+                entry->dispatch = XTEN_FUSED_L32I_ADDI_S32I;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    /**
+     * @brief Checks whether an instruction reads an address register
+     *
+     * Only instructions that can follow a load closely enough to matter are covered anything else is taken not to read it.
+     */
+    static inline bool xten_helper_readsRegister(Xtensa_lx_CPU *CPU, uint32_t op, uint32_t opcode, uint32_t reg)
+    {
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        if (xten_opFamilies[op] == XTEN_FAMILY_CONDITIONAL_BRANCH)
+        {
+            return s == reg || (t == reg && op != XTEN_OP_BBCI && op != XTEN_OP_BBSI);
+        }
+        switch (op)
+        {
+        case XTEN_OP_AND:
+        case XTEN_OP_OR:
+        case XTEN_OP_XOR:
+        case XTEN_OP_ADD:
+        case XTEN_OP_ADDX2:
+        case XTEN_OP_ADDX4:
+        case XTEN_OP_ADDX8:
+        case XTEN_OP_SUB:
+        case XTEN_OP_SUBX2:
+        case XTEN_OP_SUBX4:
+        case XTEN_OP_SUBX8:
+        case XTEN_OP_SRC:
+        case XTEN_OP_S8I:
+        case XTEN_OP_S16I:
+        case XTEN_OP_S32I:
+            return s == reg || t == reg;
+        case XTEN_OP_MOVEQZ:
+        case XTEN_OP_MOVNEZ:
+        case XTEN_OP_MOVLTZ:
+        case XTEN_OP_MOVGEZ:
+            return s == reg || t == reg || r == reg; // r keeps its old value when the move does not happen
+        case XTEN_OP_NEG:
+        case XTEN_OP_ABS:
+        case XTEN_OP_SRAI:
+        case XTEN_OP_SRLI:
+        case XTEN_OP_SRL:
+        case XTEN_OP_SRA:
+        case XTEN_OP_EXTUI:
+        case XTEN_OP_WSR:
+        case XTEN_OP_XSR:
+        case XTEN_OP_WUR:
+            return t == reg;
+        case XTEN_OP_SLLI:
+        case XTEN_OP_SLL:
+        case XTEN_OP_L8UI:
+        case XTEN_OP_L16UI:
+        case XTEN_OP_L16SI:
+        case XTEN_OP_L32I:
+        case XTEN_OP_ADDI:
+        case XTEN_OP_JX:
+        case XTEN_OP_CALLX0:
+            return s == reg;
+        case XTEN_OP_RET:
+            return reg == 0;
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * @brief Gives the bytes an instruction loads or stores
+     *
+     * @return uint32_t 1, 2 or 4 or 0 when the instruction does not access data memory through the load and store handlers
+     */
+    static inline uint32_t xten_helper_accessWidth(uint32_t op)
+    {
+        switch (op)
+        {
+        case XTEN_OP_L8UI:
+        case XTEN_OP_S8I:
+            return 1;
+        case XTEN_OP_L16UI:
+        case XTEN_OP_L16SI:
+        case XTEN_OP_S16I:
+            return 2;
+        case XTEN_OP_L32I:
+        case XTEN_OP_L32R:
+        case XTEN_OP_S32I:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Works out the cycles the timing model adds to an instruction that do not depend on what it does when it runs
+     *
+     * A load pays the load use stall when the instruction after it in memory reads what it loaded. Taken branches and
+     * wait states are only known at run time and charged then.
+     */
+    static inline uint32_t xten_helper_staticCycles(Xtensa_lx_CPU *CPU, Xtensa_lx_DecodeEntry *entry, uint32_t pc)
+    {
+        uint32_t cycles = 0;
+        uint32_t nextOpcode;
+        uint32_t nextOp;
+        if (entry->op == XTEN_OP_L32R)
+        {
+            cycles += CPU->timing.l32r;
+        }
+        if (xten_opFamilies[entry->op] == XTEN_FAMILY_LOAD && xten_helper_fuseNext(CPU, pc, 1, &nextOpcode, &nextOp) &&
+            xten_helper_readsRegister(CPU, nextOp, nextOpcode, (entry->opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F))
+        {
+            cycles += CPU->timing.loadUse;
+        }
+        return cycles;
+    }
+
+    /**
+     * @brief Fills a decode entry with the instruction at an address
+     *
+     * When the read callback raises a memory fault the entry only holds XTEN_DECODE_FAULT and is left stale so the fetch is
+     * tried again the next time the address runs.
+     */
+    static inline void xten_helper_fillEntry(Xtensa_lx_CPU *CPU, Xtensa_lx_DecodeEntry *entry, uint32_t pc)
+    {
+        uint32_t ccount = CPU->ccount;
+        Xtensa_lx_StopReason stopReason = CPU->stopReason;
+        CPU->stopReason = XTEN_STOP_NONE;
+        entry->opcode = xten_readMemory(CPU, pc) >> 8;
+        CPU->ccount = ccount; // filling the cache is not an access the timing model charges wait states for
+        entry->pc = pc;
+        if (CPU->stopReason == XTEN_STOP_MEMORY_FAULT)
+        {
+            CPU->exccause = XTEN_EXCCAUSE_INSTRUCTION_FETCH_ERROR;
+            entry->generation = CPU->generation - 1;
+            entry->flags = XTEN_DECODE_FAULT;
+            return;
+        }
+        CPU->stopReason = stopReason;
+        entry->generation = CPU->generation;
+        entry->flags = 0;
+        entry->edgeId = (pc * XTEN_COVERAGE_HASH) >> 16;
+        entry->op = xten_decodeInstruction(CPU, entry->opcode);
+        entry->handler = xten_opHandlers[entry->op];
+        if (CPU->coverageMap != NULL && xten_helper_isControlFlow(CPU, entry->opcode))
+        {
+            entry->flags |= XTEN_DECODE_EDGE;
+        }
+        if (CPU->fetchCache != NULL && (xten_helper_isControlFlow(CPU, entry->opcode) ||
+                                        (pc + 2) / XTEN_FETCH_CACHE_LINE != (pc + 5) / XTEN_FETCH_CACHE_LINE))
+        {
+            // the next instruction to run is somewhere else or reaches into a line this one does not
+            entry->flags |= XTEN_DECODE_FETCH;
+        }
+        if (CPU->timingEnabled)
+        {
+            uint32_t cycles = xten_helper_staticCycles(CPU, entry, pc);
+            if (cycles != 0 || xten_helper_isControlFlow(CPU, entry->opcode))
+            {
+                entry->flags |= XTEN_DECODE_TIMING | (cycles << XTEN_DECODE_CYCLES_SHIFT);
+            }
+        }
+        for (uint32_t i = 0; i < XTEN_MAX_INSTRUCTION_SIZE; i += XTEN_MAX_INSTRUCTION_SIZE - 1)
+        {
+            // the instruction may straddle two pages both need to know they hold code
+            Xtensa_lx_Page *page = xten_helper_createPage(CPU, pc + i);
+            if (page != NULL)
+            {
+                page->flags |= XTEN_PAGE_CODE;
+                if (i == 0 && (page->flags & XTEN_PAGE_BREAK) && xten_helper_isBreakpoint(CPU, pc))
+                {
+                    entry->flags |= XTEN_DECODE_BREAK;
+                }
+            }
+        }
+        xten_helper_fuseEntry(CPU, entry, pc);
+    }
+
+    /**
+     * @brief Fetches the decode entry for the instruction at an address
+     *
+     * On a miss the opcode is read through the memory map and the page it came from is flagged as holding code so stores to it
+     * invalidate the entry. An entry with XTEN_DECODE_FAULT set could not be fetched and must not be executed.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer fetching
+     * @param pc uint32_t address of the instruction
+     * @return Xtensa_lx_DecodeEntry pointer valid until the next fetch
+     */
+    static inline Xtensa_lx_DecodeEntry *xten_fetchEntry(Xtensa_lx_CPU *CPU, uint32_t pc)
+    {
+        if (CPU->decodeCache == NULL)
+        {
+            CPU->decodeCache = (Xtensa_lx_DecodeEntry *)xten_arenaAlloc(CPU, XTEN_DECODE_CACHE_SIZE * sizeof(Xtensa_lx_DecodeEntry));
+            if (CPU->decodeCache == NULL)
+            {
+                // no room for a cache so every fetch fills the scratch entry
+                xten_helper_fillEntry(CPU, &CPU->fetchScratch, pc);
+                return &CPU->fetchScratch;
+            }
+            for (uint32_t i = 0; i < XTEN_DECODE_CACHE_SIZE; i++)
+            {
+                CPU->decodeCache[i].pc = 0;
+                CPU->decodeCache[i].generation = CPU->generation - 1;
+            }
+        }
+
+        Xtensa_lx_DecodeEntry *entry = &CPU->decodeCache[pc & (XTEN_DECODE_CACHE_SIZE - 1)];
+        if (entry->pc != pc || entry->generation != CPU->generation)
+        {
+            xten_helper_fillEntry(CPU, entry, pc);
+        }
+        return entry;
+    }
+
+    /**
+     * @brief Counts the edge from a control flow instruction to wherever it sent the program counter
+     *
+     * Both ends are named by the edgeId worked out when their decode entries were filled so taken and not taken branches,
+     * calls, returns and indirect jumps all cost one increment. The source is shifted so A to B and B to A are different edges.
+     */
+    static inline void xten_helper_countEdge(Xtensa_lx_CPU *CPU, uint32_t fromId)
+    {
+        uint32_t toId = xten_fetchEntry(CPU, CPU->PC)->edgeId;
+        CPU->coverageMap[((fromId >> 1) ^ toId) & CPU->coverageMask]++;
+    }
+
+    /**
+     * @brief Looks up the lines the instruction at the program counter is fetched from in the fetch cache model
+     *
+     * Only called when the decoder worked out that the line may have changed so a run along a line costs one lookup. A miss
+     * fills the line and adds the miss penalty to CCOUNT.
+     */
+    static inline void xten_helper_fetchLines(Xtensa_lx_CPU *CPU)
+    {
+        Xtensa_lx_FetchCache *cache = CPU->fetchCache;
+        uint32_t line = CPU->PC & ~(uint32_t)(XTEN_FETCH_CACHE_LINE - 1);
+        uint32_t last = (CPU->PC + XTEN_MAX_INSTRUCTION_SIZE - 1) & ~(uint32_t)(XTEN_FETCH_CACHE_LINE - 1);
+        for (;; line += XTEN_FETCH_CACHE_LINE)
+        {
+            uint32_t offset = line - cache->base;
+            if (offset < cache->size && line != cache->lastLine)
+            {
+                uint32_t *tag = &cache->tags[(line / XTEN_FETCH_CACHE_LINE) & (XTEN_FETCH_CACHE_LINES - 1)];
+                Xtensa_lx_LineStats *stats = (cache->lines == NULL) ? NULL : &cache->lines[offset / XTEN_FETCH_CACHE_LINE];
+                cache->lastLine = line;
+                if (*tag == (line | 1))
+                {
+                    cache->hits++;
+                    if (stats != NULL)
+                    {
+                        stats->hits++;
+                    }
+                }
+                else
+                {
+                    *tag = line | 1;
+                    cache->misses++;
+                    CPU->ccount += cache->missCycles;
+                    if (stats != NULL)
+                    {
+                        stats->misses++;
+                    }
+                }
+            }
+            if (line == last)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Charges the timing model cycles of an instruction that just ran
+     *
+     * The cycles worked out at decode are added and if the instruction at pc sent the program counter anywhere but the next
+     * instruction the taken branch penalty is too.
+     */
+    static inline void xten_helper_chargeCycles(Xtensa_lx_CPU *CPU, uint32_t flags, uint32_t pc)
+    {
+        CPU->ccount += flags >> XTEN_DECODE_CYCLES_SHIFT;
+        if (CPU->PC != pc + XTEN_MAX_INSTRUCTION_SIZE)
+        {
+            CPU->ccount += CPU->timing.takenBranch;
+        }
+    }
+
+    /**
+     * @brief Executes a decode entry the way xten_executeNext would without decoding the opcode again
+     */
+    static inline void xten_helper_executeEntry(Xtensa_lx_CPU *CPU, Xtensa_lx_DecodeEntry *entry)
+    {
+        uint32_t opcode = entry->opcode;
+        uint32_t flags = entry->flags;
+        uint32_t pc = entry->pc;
+        CPU->dataBus = opcode << 8;
+        if (CPU->replayFile != NULL)
+        {
+            xten_helper_replayInterrupts(CPU);
+        }
+        XTEN_HELPER_COUNT_OP(CPU, entry->op);
+        entry->handler(CPU, opcode);
+        CPU->PC += 3;
+        CPU->addressLines = CPU->PC;
+        CPU->ccount++;
+        if (flags & XTEN_DECODE_TIMING)
+        {
+            xten_helper_chargeCycles(CPU, flags, pc);
+        }
+    }
+
+    /**
+     * @brief Works out the guest address a load or store instruction is about to access the way its handler will
+     */
+    static inline uint32_t xten_helper_accessAddress(Xtensa_lx_CPU *CPU, uint32_t op, uint32_t opcode, uint32_t pc)
+    {
+        if (op == XTEN_OP_L32R)
+        {
+            int32_t oneExtendedConst = (int16_t)((opcode >> (CPU->msbFirstOption ? 0 : 8)) & 0xFFFF);
+            return (pc + 3 + (oneExtendedConst << 2)) & 0xFFFFFFFC;
+        }
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF;
+        uint32_t width = xten_helper_accessWidth(op);
+        return CPU->registerFile[CPU->windowOffset + s] + imm8 * width;
+    }
+
+    /**
+     * @brief Executes a decode entry calling whichever hooks are installed around it
+     *
+     * Load and store addresses are worked out from the operands before the instruction runs so the handlers and the fast
+     * memory paths stay the same as without hooks.
+     */
+    static inline void xten_helper_executeHooked(Xtensa_lx_CPU *CPU, Xtensa_lx_DecodeEntry *entry)
+    {
+        const Xtensa_lx_Hooks *hooks = &CPU->hooks;
+        uint32_t pc = entry->pc;
+        uint32_t opcode = entry->opcode;
+        uint32_t op = entry->op;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t width = (hooks->memory != NULL) ? xten_helper_accessWidth(op) : 0;
+        bool write = xten_opFamilies[op] == XTEN_FAMILY_STORE;
+        uint32_t address = 0;
+        uint32_t value = 0;
+        if (hooks->preInstruction != NULL)
+        {
+            hooks->preInstruction(CPU, pc, opcode, hooks->context);
+        }
+        if (width != 0)
+        {
+            address = xten_helper_accessAddress(CPU, op, opcode, pc);
+            value = CPU->registerFile[CPU->windowOffset + t] & (0xFFFFFFFFU >> (32 - width * 8));
+        }
+        xten_helper_executeEntry(CPU, entry);
+        Xtensa_lx_StopReason reason = CPU->stopReason;
+        bool exception = reason == XTEN_STOP_ILLEGAL_INSTRUCTION || reason == XTEN_STOP_MEMORY_FAULT;
+        if (width != 0 && !exception)
+        {
+            if (!write)
+            {
+                value = CPU->registerFile[CPU->windowOffset + t];
+            }
+            hooks->memory(CPU, address, value, (int)width, write, hooks->context);
+        }
+        if (hooks->branch != NULL && (xten_opFamilies[op] == XTEN_FAMILY_JUMP_CALL || xten_opFamilies[op] == XTEN_FAMILY_CONDITIONAL_BRANCH))
+        {
+            hooks->branch(CPU, pc, CPU->PC, CPU->PC != pc + XTEN_MAX_INSTRUCTION_SIZE, hooks->context);
+        }
+        if (hooks->exception != NULL && exception)
+        {
+            hooks->exception(CPU, reason, hooks->context);
+        }
+        if (hooks->postInstruction != NULL)
+        {
+            hooks->postInstruction(CPU, pc, opcode, hooks->context);
+        }
+    }
+
+    /**
+     * @brief Interprets up to a number of instructions for xten_run while hooks are installed
+     *
+     * A plain loop kept apart from xten_helper_interpret and the JIT so neither of them looks at the hooks. Breakpoints,
+     * coverage and the fetch cache model behave the same as in xten_helper_interpret.
+     */
+    static inline uint32_t xten_helper_runHooked(Xtensa_lx_CPU *CPU, uint32_t maxInstructions, bool resume)
+    {
+        uint32_t executed = 0;
+        CPU->stopReason = XTEN_STOP_NONE;
+        if (CPU->fetchCache != NULL && CPU->chipEnable == XTEN_HIGH && maxInstructions != 0)
+        {
+            xten_helper_fetchLines(CPU);
+        }
+        while (executed < maxInstructions && CPU->chipEnable == XTEN_HIGH && CPU->stopReason == XTEN_STOP_NONE)
+        {
+            Xtensa_lx_DecodeEntry *entry = xten_fetchEntry(CPU, CPU->PC);
+            uint32_t flags = entry->flags;
+            uint32_t edgeId = entry->edgeId;
+            if (flags & XTEN_DECODE_FAULT)
+            {
+                break;
+            }
+            if ((flags & XTEN_DECODE_BREAK) && (executed != 0 || !resume))
+            {
+                CPU->stopReason = XTEN_STOP_BREAKPOINT;
+                break;
+            }
+            xten_helper_executeHooked(CPU, entry);
+            executed++;
+            if (flags & XTEN_DECODE_EDGE)
+            {
+                xten_helper_countEdge(CPU, edgeId);
+            }
+            if (flags & XTEN_DECODE_FETCH)
+            {
+                xten_helper_fetchLines(CPU);
+            }
+        }
+        return executed;
+    }
+
+    /**
+     * @brief Fetches and executes the instruction at the program counter
+     *
+     * Unlike xten_executeNext the CPU fetches the instruction itself through the decode cache which also holds the handler the
+     * decode tables picked for it. The data bus is still set to the fetched word so the pins look the same as when the user puts
+     * the instruction there. Breakpoints do not stop a single step but a data breakpoint hit by it is left in CPU->stopReason.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to step
+     */
+    void xten_step(Xtensa_lx_CPU *CPU)
+    {
+        if (CPU->chipEnable != XTEN_HIGH)
+        {
+            return;
+        }
+        CPU->stopReason = XTEN_STOP_NONE;
+        CPU->breakStopped = false;
+        Xtensa_lx_DecodeEntry *entry = xten_fetchEntry(CPU, CPU->PC);
+        if (entry->flags & XTEN_DECODE_FAULT)
+        {
+            return;
+        }
+        if (CPU->hooksEnabled)
+        {
+            xten_helper_executeHooked(CPU, entry);
+            return;
+        }
+        xten_helper_executeEntry(CPU, entry);
+    }
+
+    /**
+     * @brief Interprets up to a number of instructions for xten_run
+     *
+     * Every instruction in the decode tables gets its own copy of the loop body ending in its own jump to the next instruction
+     * so the host can predict what follows each instruction separately. Superinstructions get a body that runs all of their
+     * instructions and goes back to a normal fetch as soon as one of them stops, faults, jumps or invalidates code. Compilers
+     * without labels as values or with XTEN_NO_COMPUTED_GOTO defined get the same bodies as cases of a switch. A breakpoint
+     * on the first instruction only stops the run when resume is false.
+     */
+    static inline uint32_t xten_helper_interpret(Xtensa_lx_CPU *CPU, uint32_t maxInstructions, bool resume)
+    {
+        uint32_t executed = 0;
+        uint32_t flags;
+        uint32_t edgeId;
+        uint32_t opcode;
+        uint32_t pc;
+        uint32_t fusedPc;
+        uint32_t fusedGeneration;
+        uint32_t fused[XTEN_FUSE_MAX_INSTRUCTIONS - 1];
+        uint32_t fusedOps[XTEN_FUSE_MAX_INSTRUCTIONS - 1];
+        Xtensa_lx_DecodeEntry *entry;
+        CPU->stopReason = XTEN_STOP_NONE;
+        if (CPU->fetchCache != NULL && CPU->chipEnable == XTEN_HIGH && maxInstructions != 0)
+        {
+            xten_helper_fetchLines(CPU); // wherever the run starts was not looked at by an instruction before it
+        }
+
+// fetches the instruction at the program counter or leaves the loop when execution should stop before it
+#define XTEN_HELPER_FETCH_OP()                                                                                     \
+    if (executed >= maxInstructions || CPU->chipEnable != XTEN_HIGH || CPU->stopReason != XTEN_STOP_NONE)         \
+    {                                                                                                              \
+        goto stop;                                                                                                 \
+    }                                                                                                              \
+    entry = xten_fetchEntry(CPU, CPU->PC);                                                                         \
+    if (entry->flags & (XTEN_DECODE_BREAK | XTEN_DECODE_FAULT))                                                    \
+    {                                                                                                              \
+        if (entry->flags & XTEN_DECODE_FAULT)                                                                      \
+        {                                                                                                          \
+            goto stop;                                                                                             \
+        }                                                                                                          \
+        if (executed != 0 || !resume)                                                                              \
+        {                                                                                                          \
+            CPU->stopReason = XTEN_STOP_BREAKPOINT;                                                                \
+            goto stop;                                                                                             \
+        }                                                                                                          \
+    }
+
+// xten_helper_executeEntry with the handler known so each instruction calls it from its own site
+#define XTEN_HELPER_RUN_OP(handler)                                                                                \
+    flags = entry->flags;                                                                                          \
+    edgeId = entry->edgeId;                                                                                        \
+    opcode = entry->opcode;                                                                                        \
+    pc = entry->pc;                                                                                                \
+    CPU->dataBus = opcode << 8;                                                                                    \
+    if (CPU->replayFile != NULL)                                                                                   \
+    {                                                                                                              \
+        xten_helper_replayInterrupts(CPU);                                                                         \
+    }                                                                                                              \
+    XTEN_HELPER_COUNT_OP(CPU, entry->op);                                                                          \
+    handler(CPU, opcode);                                                                                          \
+    CPU->PC += 3;                                                                                                  \
+    CPU->addressLines = CPU->PC;                                                                                   \
+    CPU->ccount++;                                                                                                 \
+    executed++;                                                                                                    \
+    if (flags & (XTEN_DECODE_EDGE | XTEN_DECODE_FETCH | XTEN_DECODE_TIMING))                                       \
+    {                                                                                                              \
+        if (flags & XTEN_DECODE_TIMING)                                                                            \
+        {                                                                                                          \
+            xten_helper_chargeCycles(CPU, flags, pc);                                                              \
+        }                                                                                                          \
+        if (flags & XTEN_DECODE_EDGE)                                                                              \
+        {                                                                                                          \
+            xten_helper_countEdge(CPU, edgeId);                                                                    \
+        }                                                                                                          \
+        if (flags & XTEN_DECODE_FETCH)                                                                             \
+        {                                                                                                          \
+            xten_helper_fetchLines(CPU);                                                                           \
+        }                                                                                                          \
+    }
+
+// runs the first instruction of a superinstruction keeping what the rest need in case the entry is filled again
+#define XTEN_HELPER_RUN_FUSED_FIRST(count, handler)                                                                \
+    if (CPU->replayFile != NULL || maxInstructions - executed < (count))                                           \
+    {                                                                                                              \
+        XTEN_HELPER_RUN_OP(handler)                                                                                \
+        XTEN_HELPER_NEXT_OP                                                                                        \
+    }                                                                                                              \
+    fusedPc = CPU->PC;                                                                                             \
+    fusedGeneration = CPU->generation;                                                                             \
+    fused[0] = entry->fusedOpcodes[0];                                                                             \
+    fused[1] = entry->fusedOpcodes[1];                                                                             \
+    fusedOps[0] = entry->fusedOps[0];                                                                              \
+    fusedOps[1] = entry->fusedOps[1];                                                                              \
+    XTEN_HELPER_RUN_OP(handler)
+
+// runs a later instruction of a superinstruction if everything before it fell through to it
+#define XTEN_HELPER_RUN_FUSED(index, handler)                                                                      \
+    if (CPU->stopReason != XTEN_STOP_NONE || CPU->chipEnable != XTEN_HIGH || CPU->generation != fusedGeneration || \
+        CPU->PC != fusedPc + (index) * XTEN_MAX_INSTRUCTION_SIZE)                                                   \
+    {                                                                                                              \
+        XTEN_HELPER_NEXT_OP                                                                                        \
+    }                                                                                                              \
+    opcode = fused[(index) - 1];                                                                                   \
+    CPU->dataBus = opcode << 8;                                                                                    \
+    handler(CPU, opcode);                                                                                          \
+    CPU->PC += 3;                                                                                                  \
+    CPU->addressLines = CPU->PC;                                                                                   \
+    CPU->ccount++;                                                                                                 \
+    executed++;
+
+#define XTEN_HELPER_FUSED_PAIR(name, first, second) \
+    XTEN_HELPER_RUN_FUSED_FIRST(2, first)           \
+    XTEN_HELPER_RUN_FUSED(1, second)
+#define XTEN_HELPER_FUSED_TRIPLE(name, first, second, third) \
+    XTEN_HELPER_RUN_FUSED_FIRST(3, first)                    \
+    XTEN_HELPER_RUN_FUSED(1, second)                         \
+    XTEN_HELPER_RUN_FUSED(2, third)
+
+#ifdef XTEN_COMPUTED_GOTO
+#define XTEN_HELPER_NEXT_OP goto fetch;
+#define XTEN_HELPER_OP_LABEL(name, ...) &&xten_op_##name,
+#define XTEN_HELPER_OP_BODY(name, handler) \
+    xten_op_##name:                        \
+    {                                      \
+        XTEN_HELPER_RUN_OP(handler)        \
+        XTEN_HELPER_FETCH_OP()             \
+        goto *dispatch[entry->dispatch];   \
+    }
+#define XTEN_HELPER_PAIR_BODY(name, ...)          \
+    xten_op_##name:                               \
+    {                                             \
+        XTEN_HELPER_FUSED_PAIR(name, __VA_ARGS__) \
+        XTEN_HELPER_FETCH_OP()                    \
+        goto *dispatch[entry->dispatch];          \
+    }
+#define XTEN_HELPER_TRIPLE_BODY(name, ...)          \
+    xten_op_##name:                                 \
+    {                                               \
+        XTEN_HELPER_FUSED_TRIPLE(name, __VA_ARGS__) \
+        XTEN_HELPER_FETCH_OP()                      \
+        goto *dispatch[entry->dispatch];            \
+    }
+        static void *const dispatch[XTEN_DISPATCH_COUNT] = {XTEN_FOR_EACH_OP(XTEN_HELPER_OP_LABEL) XTEN_FOR_EACH_FUSED_PAIR(XTEN_HELPER_OP_LABEL)
+                                                                XTEN_FOR_EACH_FUSED_TRIPLE(XTEN_HELPER_OP_LABEL)};
+    fetch:
+        XTEN_HELPER_FETCH_OP()
+        goto *dispatch[entry->dispatch];
+        XTEN_FOR_EACH_OP(XTEN_HELPER_OP_BODY)
+        XTEN_FOR_EACH_FUSED_PAIR(XTEN_HELPER_PAIR_BODY)
+        XTEN_FOR_EACH_FUSED_TRIPLE(XTEN_HELPER_TRIPLE_BODY)
+#undef XTEN_HELPER_OP_LABEL
+#undef XTEN_HELPER_OP_BODY
+#undef XTEN_HELPER_PAIR_BODY
+#undef XTEN_HELPER_TRIPLE_BODY
+#else
+#define XTEN_HELPER_NEXT_OP continue;
+#define XTEN_HELPER_OP_CASE(name, handler) \
+    case XTEN_OP_##name:                   \
+    {                                      \
+        XTEN_HELPER_RUN_OP(handler)        \
+        break;                             \
+    }
+#define XTEN_HELPER_PAIR_CASE(name, ...)          \
+    case XTEN_FUSED_##name:                       \
+    {                                             \
+        XTEN_HELPER_FUSED_PAIR(name, __VA_ARGS__) \
+        break;                                    \
+    }
+#define XTEN_HELPER_TRIPLE_CASE(name, ...)          \
+    case XTEN_FUSED_##name:                         \
+    {                                               \
+        XTEN_HELPER_FUSED_TRIPLE(name, __VA_ARGS__) \
+        break;                                      \
+    }
+        for (;;)
+        {
+            XTEN_HELPER_FETCH_OP()
+            switch (entry->dispatch)
+            {
+                XTEN_FOR_EACH_OP(XTEN_HELPER_OP_CASE)
+                XTEN_FOR_EACH_FUSED_PAIR(XTEN_HELPER_PAIR_CASE)
+                XTEN_FOR_EACH_FUSED_TRIPLE(XTEN_HELPER_TRIPLE_CASE)
+            }
+        }
+#undef XTEN_HELPER_OP_CASE
+#undef XTEN_HELPER_PAIR_CASE
+#undef XTEN_HELPER_TRIPLE_CASE
+#endif
+#undef XTEN_HELPER_NEXT_OP
+#undef XTEN_HELPER_FUSED_PAIR
+#undef XTEN_HELPER_FUSED_TRIPLE
+#undef XTEN_HELPER_RUN_FUSED_FIRST
+#undef XTEN_HELPER_RUN_FUSED
+#undef XTEN_HELPER_FETCH_OP
+#undef XTEN_HELPER_RUN_OP
+    stop:
+        return executed;
+    }
+
+    /**
+     * @brief Runs up to a number of instructions
+     *
+     * Execution stops before an instruction with a breakpoint on it. Only the breakpoint the previous run stopped at is run
+     * through when the next run starts on it so calling xten_run again continues past it while any other breakpoint stops
+     * the run even on its first instruction. Execution also stops after an instruction whose load or store hit a data
+     * breakpoint. The reason for stopping is left in CPU->stopReason. With XTEN_ENABLE_JIT defined code in host memory is
+     * translated to x86-64 unless a recording is being replayed, coverage is on or the fetch cache model is on. While hooks
+     * are installed a separate loop that calls them runs instead.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to run
+     * @param maxInstructions uint32_t most instructions to execute
+     * @return uint32_t number of instructions executed stops early when the chip is disabled
+     */
+    uint32_t xten_run(Xtensa_lx_CPU *CPU, uint32_t maxInstructions)
+    {
+        bool resume = CPU->breakStopped && CPU->breakPc == CPU->PC;
+        uint32_t executed;
+        if (CPU->hooksEnabled)
+        {
+            executed = xten_helper_runHooked(CPU, maxInstructions, resume);
+        }
+#ifdef XTEN_ENABLE_JIT
+        else if (!CPU->jitFailed && CPU->replayFile == NULL && CPU->coverageMap == NULL && CPU->fetchCache == NULL)
+        {
+            executed = xten_helper_jitRun(CPU, maxInstructions, resume);
+        }
+#endif
+        else
+        {
+            executed = xten_helper_interpret(CPU, maxInstructions, resume);
+        }
+        // a run asked for no instructions leaves the breakpoint to be resumed by the next one
+        if (executed != 0 || CPU->stopReason == XTEN_STOP_BREAKPOINT)
+        {
+            CPU->breakStopped = CPU->stopReason == XTEN_STOP_BREAKPOINT;
+            CPU->breakPc = CPU->PC;
+        }
+        return executed;
+    }
+
+    /****************************************This section is for the JIT**************************************************************/
+#ifdef XTEN_ENABLE_JIT
+
+#define XTEN_JIT_EAX 0
+#define XTEN_JIT_ECX 1
+#define XTEN_JIT_PROLOGUE_SIZE 19 // bytes xten_helper_jitPrologue emits before loading the window
+#define XTEN_JIT_EPILOGUE_SIZE 22 // bytes xten_helper_jitEpilogue emits
+#define XTEN_JIT_SAR 16           // allocation slot for SAR after the 16 AR registers of the window
+#define XTEN_JIT_SLOTS 17
+#define XTEN_JIT_PIN_REGISTERS 10 // host registers guest registers can be pinned to
+
+    // a translated block is given how many instructions it and the blocks it chains to may run and returns how many are left
+    typedef uint32_t (*Xtensa_lx_JitCode)(Xtensa_lx_CPU *CPU, uint32_t budget);
+
+    /**
+     * @brief struct tracking which guest registers a block keeps in host registers
+     *
+     * A pinned register is loaded the first time the block uses it and written back only before a handler call or when the
+     * block exits. Handlers see the register file in memory so everything is written back and reloaded around them.
+     */
+    typedef struct Xtensa_lx_JitAllocation
+    {
+        int8_t host[XTEN_JIT_SLOTS]; // host register holding each AR or SAR -1 when it stays in memory
+        uint32_t loaded;             // slots whose host register holds the current value
+        uint32_t dirty;              // slots whose host register is newer than memory
+    } Xtensa_lx_JitAllocation;
+
+    // edx, esi, edi, r8d-r11d and r13d-r15d eax and ecx stay free as scratch
+    static const uint8_t xten_jitPinRegisters[XTEN_JIT_PIN_REGISTERS] = {2, 6, 7, 8, 9, 10, 11, 13, 14, 15};
+
+    static inline void xten_helper_jitFree(Xtensa_lx_CPU *CPU)
+    {
+        if (CPU->jit != NULL)
+        {
+            munmap(CPU->jit, XTEN_ALIGN_UP(sizeof(Xtensa_lx_Jit)) + XTEN_JIT_CODE_SIZE);
+            CPU->jit = NULL;
+        }
+    }
+
+    static inline void xten_helper_jitByte(Xtensa_lx_Jit *jit, uint8_t value)
+    {
+        jit->code[jit->codeUsed++] = value;
+    }
+
+    static inline void xten_helper_jitWord(Xtensa_lx_Jit *jit, uint32_t value)
+    {
+        memcpy(jit->code + jit->codeUsed, &value, sizeof(value)); // the host is little endian like x86-64 immediates
+        jit->codeUsed += sizeof(value);
+    }
+
+    static inline void xten_helper_jitQuad(Xtensa_lx_Jit *jit, uint64_t value)
+    {
+        memcpy(jit->code + jit->codeUsed, &value, sizeof(value));
+        jit->codeUsed += sizeof(value);
+    }
+
+    /**
+     * @brief Emits an x86-64 instruction whose memory operand is a CPU field rbx holds the CPU pointer in translated code
+     */
+    static inline void xten_helper_jitCPUOperand(Xtensa_lx_Jit *jit, uint8_t opcode, uint8_t reg, size_t offset)
+    {
+        if (reg >= 8)
+        {
+            xten_helper_jitByte(jit, 0x44); // REX.R
+        }
+        xten_helper_jitByte(jit, opcode);
+        xten_helper_jitByte(jit, 0x83 | ((reg & 7) << 3)); // [rbx + disp32]
+        xten_helper_jitWord(jit, (uint32_t)offset);
+    }
+
+    /**
+     * @brief Emits an x86-64 instruction whose memory operand is a guest AR register r12 points at the current window
+     */
+    static inline void xten_helper_jitGuestOperand(Xtensa_lx_Jit *jit, uint8_t opcode, uint8_t reg, uint32_t guestRegister)
+    {
+        xten_helper_jitByte(jit, reg >= 8 ? 0x45 : 0x41); // REX.B for r12 and REX.R for r8-r15
+        xten_helper_jitByte(jit, opcode);
+        xten_helper_jitByte(jit, 0x44 | ((reg & 7) << 3)); // [r12 + disp8]
+        xten_helper_jitByte(jit, 0x24);
+        xten_helper_jitByte(jit, (uint8_t)(guestRegister * sizeof(uint32_t)));
+    }
+
+    /**
+     * @brief Emits a 32 bit mov between two host registers
+     */
+    static inline void xten_helper_jitMove(Xtensa_lx_Jit *jit, uint8_t destination, uint8_t source)
+    {
+        if (destination >= 8 || source >= 8)
+        {
+            xten_helper_jitByte(jit, 0x40 | (source >= 8 ? 0x04 : 0) | (destination >= 8 ? 0x01 : 0));
+        }
+        xten_helper_jitByte(jit, 0x89);
+        xten_helper_jitByte(jit, 0xC0 | ((source & 7) << 3) | (destination & 7));
+    }
+
+    /**
+     * @brief Points r12 at registerFile[windowOffset] done on entry and after anything that may move the window
+     */
+    static inline void xten_helper_jitLoadWindow(Xtensa_lx_Jit *jit)
+    {
+        xten_helper_jitByte(jit, 0x48); // mov rax, CPU->registerFile
+        xten_helper_jitCPUOperand(jit, 0x8B, XTEN_JIT_EAX, offsetof(Xtensa_lx_CPU, registerFile));
+        xten_helper_jitByte(jit, 0x48); // movsxd rcx, CPU->windowOffset
+        xten_helper_jitCPUOperand(jit, 0x63, XTEN_JIT_ECX, offsetof(Xtensa_lx_CPU, windowOffset));
+        xten_helper_jitByte(jit, 0x4C); // lea r12, [rax + rcx * 4]
+        xten_helper_jitByte(jit, 0x8D);
+        xten_helper_jitByte(jit, 0x24);
+        xten_helper_jitByte(jit, 0x88);
+    }
+
+    /**
+     * @brief Saves the callee saved registers and keeps the CPU in rbx and the instruction budget in ebp
+     *
+     * Blocks chained to jump in after this at block->entry so only the window is loaded again.
+     */
+    static inline void xten_helper_jitPrologue(Xtensa_lx_Jit *jit)
+    {
+        xten_helper_jitByte(jit, 0x53); // push rbx
+        xten_helper_jitByte(jit, 0x55); // push rbp
+        for (uint8_t reg = 12; reg <= 15; reg++)
+        {
+            xten_helper_jitByte(jit, 0x41); // push r12-r15
+            xten_helper_jitByte(jit, 0x50 | (reg & 7));
+        }
+        xten_helper_jitByte(jit, 0x48); // sub rsp, 8 six pushes need this to leave the stack 16 byte aligned for calls
+        xten_helper_jitByte(jit, 0x83);
+        xten_helper_jitByte(jit, 0xEC);
+        xten_helper_jitByte(jit, 8);
+        xten_helper_jitByte(jit, 0x48); // mov rbx, rdi
+        xten_helper_jitByte(jit, 0x89);
+        xten_helper_jitByte(jit, 0xFB);
+        xten_helper_jitByte(jit, 0x89); // mov ebp, esi
+        xten_helper_jitByte(jit, 0xF5);
+        xten_helper_jitLoadWindow(jit);
+    }
+
+    /**
+     * @brief Returns the budget left after the current block ran executed instructions
+     */
+    static inline void xten_helper_jitEpilogue(Xtensa_lx_Jit *jit, uint32_t executed)
+    {
+        xten_helper_jitByte(jit, 0x89); // mov eax, ebp
+        xten_helper_jitByte(jit, 0xE8);
+        xten_helper_jitByte(jit, 0x2D); // sub eax, executed
+        xten_helper_jitWord(jit, executed);
+        xten_helper_jitByte(jit, 0x48); // add rsp, 8
+        xten_helper_jitByte(jit, 0x83);
+        xten_helper_jitByte(jit, 0xC4);
+        xten_helper_jitByte(jit, 8);
+        for (uint8_t reg = 15; reg >= 12; reg--)
+        {
+            xten_helper_jitByte(jit, 0x41); // pop r15-r12
+            xten_helper_jitByte(jit, 0x58 | (reg & 7));
+        }
+        xten_helper_jitByte(jit, 0x5D); // pop rbp
+        xten_helper_jitByte(jit, 0x5B); // pop rbx
+        xten_helper_jitByte(jit, 0xC3); // ret
+    }
+
+    /**
+     * @brief Throws away every translated block
+     *
+     * The code memory starts over with the exit stub and every slot and inline cache is pointed at it so stale chains leave
+     * translated code instead of jumping into code that is about to be overwritten.
+     */
+    static inline void xten_helper_jitFlush(Xtensa_lx_CPU *CPU, Xtensa_lx_Jit *jit)
+    {
+        jit->codeUsed = 0;
+        jit->generation = CPU->generation;
+        jit->stub = jit->code;
+        xten_helper_jitEpilogue(jit, 0);
+        for (uint32_t i = 0; i < XTEN_JIT_BLOCK_COUNT; i++)
+        {
+            Xtensa_lx_JitBlock *block = &jit->blocks[i];
+            block->pc = 0;
+            block->length = 0;
+            block->breakAtStart = false;
+            block->code = NULL;
+            block->entry = jit->stub;
+            block->exits[0].target = 0;
+            block->exits[0].block = &jit->blocks[0];
+            block->exits[1] = block->exits[0];
+        }
+        jit->rasTop = 0;
+        memset(jit->ras, 0, sizeof(jit->ras));
+    }
+
+    /**
+     * @brief Maps the executable memory blocks are translated into
+     *
+     * The block table sits at the start of the same mapping so the JIT is a single allocation next to the CPU block and
+     * xten_helper_jitFree gives all of it back.
+     */
+    static inline Xtensa_lx_Jit *xten_helper_jitCreate(Xtensa_lx_CPU *CPU)
+    {
+        size_t tableSize = XTEN_ALIGN_UP(sizeof(Xtensa_lx_Jit));
+        void *mapping = mmap(NULL, tableSize + XTEN_JIT_CODE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED)
+        {
+            CPU->jitFailed = true; // hosts that refuse writable executable memory keep using the interpreter
+            return NULL;
+        }
+        Xtensa_lx_Jit *jit = (Xtensa_lx_Jit *)mapping;
+        jit->code = (uint8_t *)mapping + tableSize;
+        xten_helper_jitFlush(CPU, jit);
+        CPU->jit = jit;
+        return jit;
+    }
+
+
+    /**
+     * @brief Leaves the block when the handler just called stopped the CPU or changed code
+     *
+     * Covers illegal instructions, memory faults from devices, data breakpoints, the chip being disabled and stores or ISYNC
+     * invalidating code which may include the rest of this block.
+     */
+    static inline void xten_helper_jitExitCheck(Xtensa_lx_Jit *jit, uint32_t executed)
+    {
+        size_t jumps[3];
+        xten_helper_jitCPUOperand(jit, 0x83, 7, offsetof(Xtensa_lx_CPU, stopReason)); // cmp CPU->stopReason, XTEN_STOP_NONE
+        xten_helper_jitByte(jit, XTEN_STOP_NONE);
+        xten_helper_jitByte(jit, 0x75); // jne exit
+        jumps[0] = jit->codeUsed;
+        xten_helper_jitByte(jit, 0);
+        xten_helper_jitCPUOperand(jit, 0x80, 7, offsetof(Xtensa_lx_CPU, chipEnable)); // cmp CPU->chipEnable, XTEN_HIGH
+        xten_helper_jitByte(jit, XTEN_HIGH);
+        xten_helper_jitByte(jit, 0x75);
+        jumps[1] = jit->codeUsed;
+        xten_helper_jitByte(jit, 0);
+        xten_helper_jitCPUOperand(jit, 0x81, 7, offsetof(Xtensa_lx_CPU, generation)); // cmp CPU->generation, translated generation
+        xten_helper_jitWord(jit, jit->generation);
+        xten_helper_jitByte(jit, 0x75);
+        jumps[2] = jit->codeUsed;
+        xten_helper_jitByte(jit, 0);
+        xten_helper_jitByte(jit, 0xEB); // jmp past the exit
+        xten_helper_jitByte(jit, XTEN_JIT_EPILOGUE_SIZE);
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            jit->code[jumps[i]] = (uint8_t)(jit->codeUsed - (jumps[i] + 1));
+        }
+        xten_helper_jitEpilogue(jit, executed);
+    }
+
+    /**
+     * @brief Copies a guest register or SAR into eax or ecx loading it into its pinned host register first if needed
+     */
+    static inline void xten_helper_jitRead(Xtensa_lx_Jit *jit, Xtensa_lx_JitAllocation *allocation, uint8_t reg, uint32_t slot)
+    {
+        int8_t host = allocation->host[slot];
+        if (host < 0)
+        {
+            if (slot == XTEN_JIT_SAR)
+            {
+                xten_helper_jitCPUOperand(jit, 0x8B, reg, offsetof(Xtensa_lx_CPU, sar));
+            }
+            else
+            {
+                xten_helper_jitGuestOperand(jit, 0x8B, reg, slot);
+            }
+            return;
+        }
+        if (!(allocation->loaded & (1U << slot)))
+        {
+            if (slot == XTEN_JIT_SAR)
+            {
+                xten_helper_jitCPUOperand(jit, 0x8B, (uint8_t)host, offsetof(Xtensa_lx_CPU, sar));
+            }
+            else
+            {
+                xten_helper_jitGuestOperand(jit, 0x8B, (uint8_t)host, slot);
+            }
+            allocation->loaded |= 1U << slot;
+        }
+        xten_helper_jitMove(jit, reg, (uint8_t)host);
+    }
+
+    /**
+     * @brief Puts eax into a guest register pinned ones are only written back at the next sync
+     */
+    static inline void xten_helper_jitWrite(Xtensa_lx_Jit *jit, Xtensa_lx_JitAllocation *allocation, uint32_t slot)
+    {
+        int8_t host = allocation->host[slot];
+        if (host < 0)
+        {
+            xten_helper_jitGuestOperand(jit, 0x89, XTEN_JIT_EAX, slot);
+            return;
+        }
+        xten_helper_jitMove(jit, (uint8_t)host, XTEN_JIT_EAX);
+        allocation->loaded |= 1U << slot;
+        allocation->dirty |= 1U << slot;
+    }
+
+    /**
+     * @brief Writes every dirty pinned register back to the register file and forgets what the host registers hold
+     *
+     * Emitted before handler calls because the handler works on memory and may move the window and at block exits.
+     */
+    static inline void xten_helper_jitSync(Xtensa_lx_Jit *jit, Xtensa_lx_JitAllocation *allocation)
+    {
+        for (uint32_t slot = 0; slot < XTEN_JIT_SAR; slot++)
+        {
+            if (allocation->dirty & (1U << slot))
+            {
+                xten_helper_jitGuestOperand(jit, 0x89, (uint8_t)allocation->host[slot], slot);
+            }
+        }
+        allocation->dirty = 0;
+        allocation->loaded = 0;
+    }
+
+    /**
+     * @brief Works out which slots an instruction translated natively uses
+     *
+     * @return uint32_t bit per AR slot and XTEN_JIT_SAR read or written 0 when the instruction goes through its handler
+     */
+    static inline uint32_t xten_helper_jitUses(Xtensa_lx_CPU *CPU, uint32_t op, uint32_t opcode)
+    {
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        switch (op)
+        {
+        case XTEN_OP_ADD:
+        case XTEN_OP_ADDX2:
+        case XTEN_OP_ADDX4:
+        case XTEN_OP_ADDX8:
+        case XTEN_OP_SUB:
+        case XTEN_OP_SUBX2:
+        case XTEN_OP_SUBX4:
+        case XTEN_OP_SUBX8:
+        case XTEN_OP_AND:
+        case XTEN_OP_OR:
+        case XTEN_OP_XOR:
+            return (1U << s) | (1U << t) | (1U << r);
+        case XTEN_OP_NEG:
+            return (1U << t) | (1U << r);
+        case XTEN_OP_MOVI:
+            return 1U << t;
+        case XTEN_OP_ADDI:
+            return (1U << s) | (1U << t);
+        case XTEN_OP_SRC:
+            return (1U << s) | (1U << t) | (1U << r) | (1U << XTEN_JIT_SAR);
+        case XTEN_OP_SRL:
+        case XTEN_OP_SRA:
+            return (1U << t) | (1U << r) | (1U << XTEN_JIT_SAR);
+        case XTEN_OP_SLL:
+            return (1U << s) | (1U << r) | (1U << XTEN_JIT_SAR);
+        case XTEN_OP_L32R:
+            return 1U << t; // only when xten_helper_jitLiteral could fold the literal
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Reads the literal an L32R loads at translation time when it cannot change without the JIT hearing about it
+     *
+     * Literals on pages that are read only or already hold code are folded. The page is flagged XTEN_PAGE_CODE so a store
+     * to it bumps the generation like self modifying code does and the block is translated again. Watched pages and pages
+     * behind the callbacks are left to the handler so data breakpoints and devices still see the load.
+     *
+     * @return bool true with the literal in *value when the L32R can become a move of a constant
+     */
+    static inline bool xten_helper_jitLiteral(Xtensa_lx_CPU *CPU, uint32_t pc, uint32_t opcode, uint32_t *value)
+    {
+        uint16_t constValue = (opcode >> (CPU->msbFirstOption ? 0 : 8)) & 0xFFFF;
+        int32_t oneExtendedConst = (int16_t)constValue;
+        uint32_t address = (pc + 3 + (oneExtendedConst << 2)) & 0xFFFFFFFC;
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, address);
+        if (page == NULL || (page->flags & (XTEN_PAGE_READ | XTEN_PAGE_WATCH)) != XTEN_PAGE_READ ||
+            ((page->flags & (XTEN_PAGE_WRITE | XTEN_PAGE_SNAPSHOT)) && !(page->flags & XTEN_PAGE_CODE)))
+        {
+            return false;
+        }
+        page->flags |= XTEN_PAGE_CODE;
+        *value = xten_helper_readPage(CPU, page, address);
+        return true;
+    }
+
+    /**
+     * @brief Pins the slots a block uses most to host registers
+     *
+     * Slots used once gain nothing from a host register so they stay in memory.
+     */
+    static inline void xten_helper_jitAllocate(Xtensa_lx_JitAllocation *allocation, const uint32_t *useCounts)
+    {
+        memset(allocation->host, -1, sizeof(allocation->host));
+        allocation->loaded = 0;
+        allocation->dirty = 0;
+        for (uint32_t i = 0; i < XTEN_JIT_PIN_REGISTERS; i++)
+        {
+            uint32_t best = XTEN_JIT_SLOTS;
+            for (uint32_t slot = 0; slot < XTEN_JIT_SLOTS; slot++)
+            {
+                if (allocation->host[slot] < 0 && useCounts[slot] >= 2 && (best == XTEN_JIT_SLOTS || useCounts[slot] > useCounts[best]))
+                {
+                    best = slot;
+                }
+            }
+            if (best == XTEN_JIT_SLOTS)
+            {
+                break;
+            }
+            allocation->host[best] = (int8_t)xten_jitPinRegisters[i];
+        }
+    }
+
+    /**
+     * @brief Translates the instructions simple enough to write as x86-64 directly
+     *
+     * Each one computes exactly what its handler does so a block runs the same with or without it. The variable shifts use
+     * the x86-64 shift instructions the handlers compile to so SAR values past 31 give the same result too. Only
+     * instructions xten_helper_jitUses lists are passed in. literal is the value a folded L32R loads.
+     */
+    static inline void xten_helper_jitNative(Xtensa_lx_CPU *CPU, Xtensa_lx_Jit *jit, Xtensa_lx_JitAllocation *allocation, uint32_t op, uint32_t opcode,
+                                             uint32_t literal)
+    {
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        uint8_t alu = 0;   // x86-64 opcode of alu eax, ecx
+        uint8_t shift = 0; // ADDX and SUBX shift AR[s] first
+        switch (op)
+        {
+        case XTEN_OP_ADD:
+        case XTEN_OP_ADDX2:
+        case XTEN_OP_ADDX4:
+        case XTEN_OP_ADDX8:
+            alu = 0x01;
+            shift = (uint8_t)(op - XTEN_OP_ADD);
+            break;
+        case XTEN_OP_SUB:
+        case XTEN_OP_SUBX2:
+        case XTEN_OP_SUBX4:
+        case XTEN_OP_SUBX8:
+            alu = 0x29;
+            shift = (uint8_t)(op - XTEN_OP_SUB);
+            break;
+        case XTEN_OP_AND:
+            alu = 0x21;
+            break;
+        case XTEN_OP_OR:
+            alu = 0x09;
+            break;
+        case XTEN_OP_XOR:
+            alu = 0x31;
+            break;
+        case XTEN_OP_NEG:
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_EAX, t);
+            xten_helper_jitByte(jit, 0xF7); // neg eax
+            xten_helper_jitByte(jit, 0xD8);
+            xten_helper_jitWrite(jit, allocation, r);
+            return;
+        case XTEN_OP_MOVI:
+        {
+            uint32_t imm12 = ((s << 8) | (opcode >> (CPU->msbFirstOption ? 0 : 16))) & 0xFF;
+            xten_helper_jitByte(jit, 0xB8); // mov eax, value
+            xten_helper_jitWord(jit, (uint32_t)(((int32_t)imm12 << 20) >> 20));
+            xten_helper_jitWrite(jit, allocation, t);
+            return;
+        }
+        case XTEN_OP_L32R:
+            xten_helper_jitByte(jit, 0xB8); // mov eax, literal
+            xten_helper_jitWord(jit, literal);
+            xten_helper_jitWrite(jit, allocation, t);
+            return;
+        case XTEN_OP_ADDI:
+        {
+            int8_t imm8 = (opcode >> (int8_t)((CPU->msbFirstOption ? 0 : 20)) & 0x0F);
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_EAX, s);
+            xten_helper_jitByte(jit, 0x05); // add eax, imm32
+            xten_helper_jitWord(jit, (uint32_t)(int32_t)imm8);
+            xten_helper_jitWrite(jit, allocation, t);
+            return;
+        }
+        case XTEN_OP_SRC:
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_EAX, t);
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_ECX, s);
+            xten_helper_jitByte(jit, 0x48); // shl rcx, 32
+            xten_helper_jitByte(jit, 0xC1);
+            xten_helper_jitByte(jit, 0xE1);
+            xten_helper_jitByte(jit, 32);
+            xten_helper_jitByte(jit, 0x48); // or rax, rcx
+            xten_helper_jitByte(jit, 0x09);
+            xten_helper_jitByte(jit, 0xC8);
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_ECX, XTEN_JIT_SAR);
+            xten_helper_jitByte(jit, 0x48); // shr rax, cl
+            xten_helper_jitByte(jit, 0xD3);
+            xten_helper_jitByte(jit, 0xE8);
+            xten_helper_jitWrite(jit, allocation, r);
+            return;
+        case XTEN_OP_SRL:
+        case XTEN_OP_SRA:
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_EAX, t);
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_ECX, XTEN_JIT_SAR);
+            xten_helper_jitByte(jit, 0xD3); // shr or sar eax, cl
+            xten_helper_jitByte(jit, op == XTEN_OP_SRL ? 0xE8 : 0xF8);
+            xten_helper_jitWrite(jit, allocation, r);
+            return;
+        case XTEN_OP_SLL:
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_EAX, s);
+            xten_helper_jitRead(jit, allocation, XTEN_JIT_ECX, XTEN_JIT_SAR);
+            xten_helper_jitByte(jit, 0xF7); // neg ecx
+            xten_helper_jitByte(jit, 0xD9);
+            xten_helper_jitByte(jit, 0x83); // add ecx, 32
+            xten_helper_jitByte(jit, 0xC1);
+            xten_helper_jitByte(jit, 32);
+            xten_helper_jitByte(jit, 0xD3); // shl eax, cl
+            xten_helper_jitByte(jit, 0xE0);
+            xten_helper_jitWrite(jit, allocation, r);
+            return;
+        default:
+            return;
+        }
+        xten_helper_jitRead(jit, allocation, XTEN_JIT_EAX, s);
+        if (shift != 0)
+        {
+            xten_helper_jitByte(jit, 0xC1); // shl eax, shift
+            xten_helper_jitByte(jit, 0xE0);
+            xten_helper_jitByte(jit, shift);
+        }
+        xten_helper_jitRead(jit, allocation, XTEN_JIT_ECX, t);
+        xten_helper_jitByte(jit, alu);
+        xten_helper_jitByte(jit, 0xC8); // eax, ecx
+        xten_helper_jitWrite(jit, allocation, r);
+    }
+
+    static inline uint8_t *xten_helper_jitLink(Xtensa_lx_CPU *CPU, Xtensa_lx_JitCache *cache);
+
+    /**
+     * @brief Emits a jump through an inline cache the cache pointer is in rcx and CPU->PC in eax
+     *
+     * A hit goes straight to the cached block's entry. A miss calls xten_helper_jitLink which fills the cache and returns
+     * where to go.
+     */
+    static inline void xten_helper_jitCacheJump(Xtensa_lx_Jit *jit)
+    {
+        xten_helper_jitByte(jit, 0x3B); // cmp eax, [rcx + target]
+        xten_helper_jitByte(jit, 0x41);
+        xten_helper_jitByte(jit, (uint8_t)offsetof(Xtensa_lx_JitCache, target));
+        xten_helper_jitByte(jit, 0x75); // jne miss
+        size_t jumps[2];
+        jumps[0] = jit->codeUsed;
+        xten_helper_jitByte(jit, 0);
+        xten_helper_jitByte(jit, 0x48); // mov rdx, [rcx + block]
+        xten_helper_jitByte(jit, 0x8B);
+        xten_helper_jitByte(jit, 0x51);
+        xten_helper_jitByte(jit, (uint8_t)offsetof(Xtensa_lx_JitCache, block));
+        xten_helper_jitByte(jit, 0x3B); // cmp eax, [rdx + pc]
+        xten_helper_jitByte(jit, 0x42);
+        xten_helper_jitByte(jit, (uint8_t)offsetof(Xtensa_lx_JitBlock, pc));
+        xten_helper_jitByte(jit, 0x75); // jne miss
+        jumps[1] = jit->codeUsed;
+        xten_helper_jitByte(jit, 0);
+        xten_helper_jitByte(jit, 0xFF); // jmp [rdx + entry]
+        xten_helper_jitByte(jit, 0x62);
+        xten_helper_jitByte(jit, (uint8_t)offsetof(Xtensa_lx_JitBlock, entry));
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            jit->code[jumps[i]] = (uint8_t)(jit->codeUsed - (jumps[i] + 1));
+        }
+        xten_helper_jitByte(jit, 0x48); // mov rdi, rbx
+        xten_helper_jitByte(jit, 0x89);
+        xten_helper_jitByte(jit, 0xDF);
+        xten_helper_jitByte(jit, 0x48); // mov rsi, rcx
+        xten_helper_jitByte(jit, 0x89);
+        xten_helper_jitByte(jit, 0xCE);
+        xten_helper_jitByte(jit, 0x48); // mov rax, xten_helper_jitLink
+        xten_helper_jitByte(jit, 0xB8);
+        xten_helper_jitQuad(jit, (uint64_t)(uintptr_t)xten_helper_jitLink);
+        xten_helper_jitByte(jit, 0xFF); // call rax
+        xten_helper_jitByte(jit, 0xD0);
+        xten_helper_jitByte(jit, 0xFF); // jmp rax
+        xten_helper_jitByte(jit, 0xE0);
+    }
+
+    /**
+     * @brief Ends a block by jumping straight to the block for wherever the guest went next
+     *
+     * Every register has been written back by now. The budget in ebp is charged for the block and the chain only goes on
+     * while any block still fits in it and nothing stopped the CPU or changed code. CALL0 and CALLX0 push their return
+     * address so the RET of the function they call tries the block after the call before its own inline cache. A branch
+     * keeps its taken and fall through targets in separate caches.
+     */
+    static inline void xten_helper_jitChain(Xtensa_lx_Jit *jit, Xtensa_lx_JitBlock *block, uint32_t lastOp, uint32_t next)
+    {
+        xten_helper_jitByte(jit, 0x81); // sub ebp, length
+        xten_helper_jitByte(jit, 0xED);
+        xten_helper_jitWord(jit, block->length);
+        xten_helper_jitExitCheck(jit, 0);
+        xten_helper_jitByte(jit, 0x83); // cmp ebp, XTEN_JIT_MAX_BLOCK
+        xten_helper_jitByte(jit, 0xFD);
+        xten_helper_jitByte(jit, XTEN_JIT_MAX_BLOCK);
+        xten_helper_jitByte(jit, 0x73); // jae past the exit
+        xten_helper_jitByte(jit, XTEN_JIT_EPILOGUE_SIZE);
+        xten_helper_jitEpilogue(jit, 0);
+
+        if (lastOp == XTEN_OP_CALL0 || lastOp == XTEN_OP_CALLX0 || lastOp == XTEN_OP_RET)
+        {
+            xten_helper_jitByte(jit, 0x48); // mov rcx, &jit->rasTop
+            xten_helper_jitByte(jit, 0xB9);
+            xten_helper_jitQuad(jit, (uint64_t)(uintptr_t)&jit->rasTop);
+            xten_helper_jitByte(jit, 0x8B); // mov edx, [rcx]
+            xten_helper_jitByte(jit, 0x11);
+        }
+        if (lastOp == XTEN_OP_CALL0 || lastOp == XTEN_OP_CALLX0)
+        {
+            xten_helper_jitByte(jit, 0xFF); // inc edx
+            xten_helper_jitByte(jit, 0xC2);
+            xten_helper_jitByte(jit, 0x83); // and edx, XTEN_JIT_RAS_SIZE - 1
+            xten_helper_jitByte(jit, 0xE2);
+            xten_helper_jitByte(jit, XTEN_JIT_RAS_SIZE - 1);
+            xten_helper_jitByte(jit, 0x89); // mov [rcx], edx
+            xten_helper_jitByte(jit, 0x11);
+            xten_helper_jitByte(jit, 0xC7); // mov dword [rcx + rdx * 4 + ras], next
+            xten_helper_jitByte(jit, 0x44);
+            xten_helper_jitByte(jit, 0x91);
+            xten_helper_jitByte(jit, (uint8_t)(offsetof(Xtensa_lx_Jit, ras) - offsetof(Xtensa_lx_Jit, rasTop)));
+            xten_helper_jitWord(jit, next);
+        }
+        xten_helper_jitCPUOperand(jit, 0x8B, XTEN_JIT_EAX, offsetof(Xtensa_lx_CPU, PC)); // mov eax, CPU->PC
+        size_t jumps[2] = {0, 0};
+        if (lastOp == XTEN_OP_RET)
+        {
+            xten_helper_jitByte(jit, 0x8B); // mov esi, [rcx + rdx * 4 + ras]
+            xten_helper_jitByte(jit, 0x74);
+            xten_helper_jitByte(jit, 0x91);
+            xten_helper_jitByte(jit, (uint8_t)(offsetof(Xtensa_lx_Jit, ras) - offsetof(Xtensa_lx_Jit, rasTop)));
+            xten_helper_jitByte(jit, 0xFF); // dec edx
+            xten_helper_jitByte(jit, 0xCA);
+            xten_helper_jitByte(jit, 0x83); // and edx, XTEN_JIT_RAS_SIZE - 1
+            xten_helper_jitByte(jit, 0xE2);
+            xten_helper_jitByte(jit, XTEN_JIT_RAS_SIZE - 1);
+            xten_helper_jitByte(jit, 0x89); // mov [rcx], edx
+            xten_helper_jitByte(jit, 0x11);
+            xten_helper_jitByte(jit, 0x39); // cmp esi, eax
+            xten_helper_jitByte(jit, 0xC6);
+            xten_helper_jitByte(jit, 0x75); // jne mispredicted
+            jumps[0] = jit->codeUsed;
+            xten_helper_jitByte(jit, 0);
+            xten_helper_jitByte(jit, 0x81); // and esi, XTEN_JIT_BLOCK_COUNT - 1
+            xten_helper_jitByte(jit, 0xE6);
+            xten_helper_jitWord(jit, XTEN_JIT_BLOCK_COUNT - 1);
+            xten_helper_jitByte(jit, 0x69); // imul esi, esi, sizeof(Xtensa_lx_JitBlock)
+            xten_helper_jitByte(jit, 0xF6);
+            xten_helper_jitWord(jit, (uint32_t)sizeof(Xtensa_lx_JitBlock));
+            xten_helper_jitByte(jit, 0x48); // mov rdx, jit->blocks
+            xten_helper_jitByte(jit, 0xBA);
+            xten_helper_jitQuad(jit, (uint64_t)(uintptr_t)jit->blocks);
+            xten_helper_jitByte(jit, 0x48); // add rdx, rsi
+            xten_helper_jitByte(jit, 0x01);
+            xten_helper_jitByte(jit, 0xF2);
+            xten_helper_jitByte(jit, 0x3B); // cmp eax, [rdx + pc]
+            xten_helper_jitByte(jit, 0x42);
+            xten_helper_jitByte(jit, (uint8_t)offsetof(Xtensa_lx_JitBlock, pc));
+            xten_helper_jitByte(jit, 0x75); // jne mispredicted
+            jumps[1] = jit->codeUsed;
+            xten_helper_jitByte(jit, 0);
+            xten_helper_jitByte(jit, 0xFF); // jmp [rdx + entry]
+            xten_helper_jitByte(jit, 0x62);
+            xten_helper_jitByte(jit, (uint8_t)offsetof(Xtensa_lx_JitBlock, entry));
+            for (uint32_t i = 0; i < 2; i++)
+            {
+                jit->code[jumps[i]] = (uint8_t)(jit->codeUsed - (jumps[i] + 1));
+            }
+        }
+        xten_helper_jitByte(jit, 0x48); // mov rcx, &block->exits[0]
+        xten_helper_jitByte(jit, 0xB9);
+        xten_helper_jitQuad(jit, (uint64_t)(uintptr_t)&block->exits[0]);
+        if (xten_opFamilies[lastOp] == XTEN_FAMILY_CONDITIONAL_BRANCH)
+        {
+            xten_helper_jitByte(jit, 0x3D); // cmp eax, next
+            xten_helper_jitWord(jit, next);
+            xten_helper_jitByte(jit, 0x75); // jne past the fall through cache
+            xten_helper_jitByte(jit, 10);
+            xten_helper_jitByte(jit, 0x48); // mov rcx, &block->exits[1]
+            xten_helper_jitByte(jit, 0xB9);
+            xten_helper_jitQuad(jit, (uint64_t)(uintptr_t)&block->exits[1]);
+        }
+        xten_helper_jitCacheJump(jit);
+    }
+
+    /**
+     * @brief Translates the basic block starting at an address
+     *
+     * The block ends after a jump, call, branch or illegal instruction, before an instruction with a breakpoint, before code
+     * that is not in host memory or after XTEN_JIT_MAX_BLOCK instructions. The block is decoded first so the registers its
+     * native instructions use most can be pinned. PC and CCOUNT are only written back before a handler call and when the
+     * block exits. The cycles the timing model worked out at decode are folded into the CCOUNT updates so only the taken
+     * branch penalty at the end of the block costs anything while it runs. L32R literals that cannot change behind the JIT's
+     * back are folded into the code as constants. The end of the block chains to the next one through xten_helper_jitChain.
+     */
+    static inline Xtensa_lx_JitBlock *xten_helper_jitTranslate(Xtensa_lx_CPU *CPU, Xtensa_lx_Jit *jit, uint32_t pc)
+    {
+        if (XTEN_JIT_CODE_SIZE - jit->codeUsed < XTEN_JIT_MAX_BLOCK_BYTES)
+        {
+            xten_helper_jitFlush(CPU, jit);
+        }
+        Xtensa_lx_JitBlock *block = &jit->blocks[pc & (XTEN_JIT_BLOCK_COUNT - 1)];
+        block->pc = pc;
+        block->code = jit->code + jit->codeUsed;
+        block->breakAtStart = false;
+        block->exits[0].target = 0;
+        block->exits[0].block = &jit->blocks[0];
+        block->exits[1] = block->exits[0];
+
+        uint32_t opcodes[XTEN_JIT_MAX_BLOCK];
+        uint32_t ops[XTEN_JIT_MAX_BLOCK];
+        uint32_t uses[XTEN_JIT_MAX_BLOCK];
+        uint32_t literals[XTEN_JIT_MAX_BLOCK];
+        uint32_t cycles[XTEN_JIT_MAX_BLOCK];
+        void (*handlers[XTEN_JIT_MAX_BLOCK])(Xtensa_lx_CPU *CPU, uint32_t opcode);
+        uint32_t useCounts[XTEN_JIT_SLOTS] = {0};
+        uint32_t count = 0;
+        while (count < XTEN_JIT_MAX_BLOCK)
+        {
+            uint32_t address = pc + count * XTEN_MAX_INSTRUCTION_SIZE;
+            if (count != 0 && !xten_helper_hostReadable(CPU, address, XTEN_MAX_INSTRUCTION_SIZE))
+            {
+                break; // fetching from a device must only happen if the instruction really runs
+            }
+            Xtensa_lx_DecodeEntry *entry = xten_fetchEntry(CPU, address);
+            if (entry->flags & XTEN_DECODE_BREAK)
+            {
+                if (count != 0)
+                {
+                    break;
+                }
+                block->breakAtStart = true;
+            }
+            opcodes[count] = entry->opcode;
+            ops[count] = entry->op;
+            handlers[count] = entry->handler;
+            cycles[count] = 1 + (entry->flags >> XTEN_DECODE_CYCLES_SHIFT);
+            uses[count] = xten_helper_jitUses(CPU, entry->op, entry->opcode);
+            literals[count] = 0;
+            if (entry->op == XTEN_OP_L32R && !xten_helper_jitLiteral(CPU, address, entry->opcode, &literals[count]))
+            {
+                uses[count] = 0;
+            }
+            for (uint32_t slot = 0; slot < XTEN_JIT_SLOTS; slot++)
+            {
+                useCounts[slot] += (uses[count] >> slot) & 1;
+            }
+            count++;
+            if (xten_opFamilies[entry->op] == XTEN_FAMILY_JUMP_CALL || xten_opFamilies[entry->op] == XTEN_FAMILY_CONDITIONAL_BRANCH ||
+                xten_opFamilies[entry->op] == XTEN_FAMILY_ILLEGAL)
+            {
+                break;
+            }
+        }
+
+        Xtensa_lx_JitAllocation allocation;
+        xten_helper_jitAllocate(&allocation, useCounts);
+        xten_helper_jitPrologue(jit);
+        uint32_t pending = 0; // cycles since CCOUNT was last written back
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t address = pc + i * XTEN_MAX_INSTRUCTION_SIZE;
+#ifdef XTEN_ENABLE_STATS
+            xten_helper_jitByte(jit, 0x48); // inc qword CPU->stats.ops[op]
+            xten_helper_jitCPUOperand(jit, 0xFF, 0, offsetof(Xtensa_lx_CPU, stats.ops) + ops[i] * sizeof(uint64_t));
+#endif
+            if (uses[i] != 0)
+            {
+                xten_helper_jitNative(CPU, jit, &allocation, ops[i], opcodes[i], literals[i]);
+                pending += cycles[i];
+                continue;
+            }
+
+            xten_helper_jitSync(jit, &allocation);
+            if (pending != 0)
+            {
+                xten_helper_jitCPUOperand(jit, 0x81, 0, offsetof(Xtensa_lx_CPU, ccount)); // add CPU->ccount, pending
+                xten_helper_jitWord(jit, pending);
+                pending = 0;
+            }
+            xten_helper_jitCPUOperand(jit, 0xC7, 0, offsetof(Xtensa_lx_CPU, PC)); // mov CPU->PC, address
+            xten_helper_jitWord(jit, address);
+            xten_helper_jitCPUOperand(jit, 0xC7, 0, offsetof(Xtensa_lx_CPU, dataBus)); // mov CPU->dataBus, opcode << 8
+            xten_helper_jitWord(jit, opcodes[i] << 8);
+            xten_helper_jitByte(jit, 0x48); // mov rdi, rbx
+            xten_helper_jitByte(jit, 0x89);
+            xten_helper_jitByte(jit, 0xDF);
+            xten_helper_jitByte(jit, 0xBE); // mov esi, opcode
+            xten_helper_jitWord(jit, opcodes[i]);
+            xten_helper_jitByte(jit, 0x48); // mov rax, handler
+            xten_helper_jitByte(jit, 0xB8);
+            xten_helper_jitQuad(jit, (uint64_t)(uintptr_t)handlers[i]);
+            xten_helper_jitByte(jit, 0xFF); // call rax
+            xten_helper_jitByte(jit, 0xD0);
+            xten_helper_jitCPUOperand(jit, 0x81, 0, offsetof(Xtensa_lx_CPU, PC)); // add CPU->PC, 3
+            xten_helper_jitWord(jit, 3);
+            xten_helper_jitCPUOperand(jit, 0x8B, XTEN_JIT_EAX, offsetof(Xtensa_lx_CPU, PC)); // CPU->addressLines = CPU->PC
+            xten_helper_jitCPUOperand(jit, 0x89, XTEN_JIT_EAX, offsetof(Xtensa_lx_CPU, addressLines));
+            xten_helper_jitCPUOperand(jit, 0x81, 0, offsetof(Xtensa_lx_CPU, ccount)); // add CPU->ccount, cycles
+            xten_helper_jitWord(jit, cycles[i]);
+            if (i + 1 < count)
+            {
+                xten_helper_jitExitCheck(jit, i + 1);
+                xten_helper_jitLoadWindow(jit);
+            }
+        }
+
+        if (pending != 0)
+        {
+            uint32_t next = pc + count * XTEN_MAX_INSTRUCTION_SIZE;
+            xten_helper_jitSync(jit, &allocation);
+            xten_helper_jitCPUOperand(jit, 0xC7, 0, offsetof(Xtensa_lx_CPU, PC));
+            xten_helper_jitWord(jit, next);
+            xten_helper_jitCPUOperand(jit, 0xC7, 0, offsetof(Xtensa_lx_CPU, addressLines));
+            xten_helper_jitWord(jit, next);
+            xten_helper_jitCPUOperand(jit, 0x81, 0, offsetof(Xtensa_lx_CPU, ccount));
+            xten_helper_jitWord(jit, pending);
+            xten_helper_jitCPUOperand(jit, 0xC7, 0, offsetof(Xtensa_lx_CPU, dataBus));
+            xten_helper_jitWord(jit, opcodes[count - 1] << 8);
+        }
+        if (CPU->timingEnabled && uses[count - 1] == 0 && xten_helper_isControlFlow(CPU, opcodes[count - 1]))
+        {
+            xten_helper_jitCPUOperand(jit, 0x81, 7, offsetof(Xtensa_lx_CPU, PC)); // cmp CPU->PC, next
+            xten_helper_jitWord(jit, pc + count * XTEN_MAX_INSTRUCTION_SIZE);
+            xten_helper_jitByte(jit, 0x74); // je past the penalty
+            xten_helper_jitByte(jit, 10);
+            xten_helper_jitCPUOperand(jit, 0x81, 0, offsetof(Xtensa_lx_CPU, ccount)); // add CPU->ccount, takenBranch
+            xten_helper_jitWord(jit, CPU->timing.takenBranch);
+        }
+        block->length = count;
+        xten_helper_jitChain(jit, block, ops[count - 1], pc + count * XTEN_MAX_INSTRUCTION_SIZE);
+        // xten_run has to see a breakpoint at the start of a block so nothing chains into one
+        block->entry = block->breakAtStart ? jit->stub : block->code + XTEN_JIT_PROLOGUE_SIZE;
+        return block;
+    }
+
+    /**
+     * @brief Finds or translates the block for CPU->PC when translated code misses an inline cache
+     *
+     * Called from translated code so it never flushes. When there is no room left, the code is not in host memory or the
+     * block starts with a breakpoint it returns the exit stub and xten_helper_jitRun takes over.
+     *
+     * @return uint8_t pointer translated code jumps to
+     */
+    static inline uint8_t *xten_helper_jitLink(Xtensa_lx_CPU *CPU, Xtensa_lx_JitCache *cache)
+    {
+        Xtensa_lx_Jit *jit = CPU->jit;
+        uint32_t pc = CPU->PC;
+        Xtensa_lx_JitBlock *block = &jit->blocks[pc & (XTEN_JIT_BLOCK_COUNT - 1)];
+        if (block->code == NULL || block->pc != pc)
+        {
+            if (XTEN_JIT_CODE_SIZE - jit->codeUsed < XTEN_JIT_MAX_BLOCK_BYTES || !xten_helper_hostReadable(CPU, pc, XTEN_MAX_INSTRUCTION_SIZE))
+            {
+                return jit->stub;
+            }
+            block = xten_helper_jitTranslate(CPU, jit, pc);
+        }
+        cache->target = pc;
+        cache->block = block;
+        return block->entry;
+    }
+
+    /**
+     * @brief Runs translated blocks for xten_run
+     *
+     * Blocks chain into each other in translated code and only come back here when a chain misses, runs low on budget or
+     * the CPU stops. Code behind the callbacks, the tail of a run too short for the next block and anything once the JIT
+     * could not get executable memory go through the interpreter.
+     */
+    static inline uint32_t xten_helper_jitRun(Xtensa_lx_CPU *CPU, uint32_t maxInstructions, bool resume)
+    {
+        Xtensa_lx_Jit *jit = (CPU->jit != NULL) ? CPU->jit : xten_helper_jitCreate(CPU);
+        if (jit == NULL)
+        {
+            return xten_helper_interpret(CPU, maxInstructions, resume);
+        }
+        uint32_t executed = 0;
+        CPU->stopReason = XTEN_STOP_NONE;
+        while (executed < maxInstructions && CPU->chipEnable == XTEN_HIGH && CPU->stopReason == XTEN_STOP_NONE)
+        {
+            if (jit->generation != CPU->generation)
+            {
+                xten_helper_jitFlush(CPU, jit);
+            }
+            Xtensa_lx_JitBlock *block = &jit->blocks[CPU->PC & (XTEN_JIT_BLOCK_COUNT - 1)];
+            if (block->code == NULL || block->pc != CPU->PC)
+            {
+                if (!xten_helper_hostReadable(CPU, CPU->PC, XTEN_MAX_INSTRUCTION_SIZE))
+                {
+                    Xtensa_lx_DecodeEntry *entry = xten_fetchEntry(CPU, CPU->PC);
+                    if (entry->flags & XTEN_DECODE_FAULT)
+                    {
+                        break;
+                    }
+                    if ((entry->flags & XTEN_DECODE_BREAK) && (executed != 0 || !resume))
+                    {
+                        CPU->stopReason = XTEN_STOP_BREAKPOINT;
+                        break;
+                    }
+                    xten_helper_executeEntry(CPU, entry);
+                    executed++;
+                    continue;
+                }
+                block = xten_helper_jitTranslate(CPU, jit, CPU->PC);
+            }
+            if (block->breakAtStart && (executed != 0 || !resume))
+            {
+                CPU->stopReason = XTEN_STOP_BREAKPOINT;
+                break;
+            }
+            if (block->length > maxInstructions - executed)
+            {
+                executed += xten_helper_interpret(CPU, maxInstructions - executed, executed == 0 && resume);
+                break;
+            }
+            uint32_t budget = maxInstructions - executed;
+            executed += budget - ((Xtensa_lx_JitCode)(void *)block->code)(CPU, budget);
+        }
+        return executed;
+    }
+
+#endif
+
+    /****************************************This section is for breakpoints and watchpoints**************************************************************/
+
+    /**
+     * @brief Works out whether a page still has any instruction breakpoint on it
+     */
+    static inline void xten_helper_refreshBreakPage(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_Page *page = xten_helper_createPage(CPU, address);
+        if (page == NULL)
+        {
+            return;
+        }
+        bool hasBreak = false;
+        for (uint32_t i = 0; i < CPU->breakpointCount && !hasBreak; i++)
+        {
+            hasBreak = (CPU->breakpoints[i] >> XTEN_PAGE_SHIFT) == (address >> XTEN_PAGE_SHIFT);
+        }
+        for (uint32_t i = 0; i < XTEN_IBREAK_COUNT && !hasBreak; i++)
+        {
+            hasBreak = (CPU->ibreakenable & (1U << i)) && (CPU->ibreaka[i] >> XTEN_PAGE_SHIFT) == (address >> XTEN_PAGE_SHIFT);
+        }
+        page->flags = hasBreak ? (page->flags | XTEN_PAGE_BREAK) : (page->flags & ~(uint32_t)XTEN_PAGE_BREAK);
+        // the cached entry for this address has to be filled again to pick up the change
+        xten_invalidateCode(CPU, address, 1);
+    }
+
+    /**
+     * @brief Adds a software breakpoint
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to add the breakpoint to
+     * @param address uint32_t address of the instruction to stop before
+     * @return bool false when all XTEN_MAX_BREAKPOINTS are in use
+     */
+    bool xten_addBreakpoint(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        for (uint32_t i = 0; i < CPU->breakpointCount; i++)
+        {
+            if (CPU->breakpoints[i] == address)
+            {
+                return true;
+            }
+        }
+        if (CPU->breakpointCount == XTEN_MAX_BREAKPOINTS)
+        {
+            return false;
+        }
+        CPU->breakpoints[CPU->breakpointCount++] = address;
+        xten_helper_refreshBreakPage(CPU, address);
+        return true;
+    }
+
+    /**
+     * @brief Removes a software breakpoint
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to remove the breakpoint from
+     * @param address uint32_t address the breakpoint was set on
+     * @return bool false if there was no breakpoint at that address
+     */
+    bool xten_removeBreakpoint(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        for (uint32_t i = 0; i < CPU->breakpointCount; i++)
+        {
+            if (CPU->breakpoints[i] == address)
+            {
+                CPU->breakpoints[i] = CPU->breakpoints[--CPU->breakpointCount];
+                xten_helper_refreshBreakPage(CPU, address);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Writes an IBREAKA register or IBREAKENABLE the way WSR does
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param sr uint32_t IBREAKA0_NUM..IBREAKA15_NUM or IBREAKENABLE_NUM
+     * @param value uint32_t value written
+     */
+    void xten_writeIBreak(Xtensa_lx_CPU *CPU, uint32_t sr, uint32_t value)
+    {
+        uint32_t oldAddresses[XTEN_IBREAK_COUNT];
+        uint32_t oldEnable = CPU->ibreakenable;
+        memcpy(oldAddresses, CPU->ibreaka, sizeof(oldAddresses));
+
+        if (sr == IBREAKENABLE_NUM)
+        {
+            CPU->ibreakenable = value & ((XTEN_IBREAK_COUNT >= 32) ? 0xFFFFFFFF : ((1U << XTEN_IBREAK_COUNT) - 1));
+        }
+        else if (sr >= IBREAKA0_NUM && sr < IBREAKA0_NUM + XTEN_IBREAK_COUNT)
+        {
+            CPU->ibreaka[sr - IBREAKA0_NUM] = value;
+        }
+
+        for (uint32_t i = 0; i < XTEN_IBREAK_COUNT; i++)
+        {
+            bool wasOn = oldEnable & (1U << i);
+            bool isOn = CPU->ibreakenable & (1U << i);
+            if (wasOn != isOn || (isOn && oldAddresses[i] != CPU->ibreaka[i]))
+            {
+                if (wasOn)
+                {
+                    xten_helper_refreshBreakPage(CPU, oldAddresses[i]);
+                }
+                if (isOn)
+                {
+                    xten_helper_refreshBreakPage(CPU, CPU->ibreaka[i]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Works out whether a page is still covered by any enabled data breakpoint
+     */
+    static inline void xten_helper_refreshWatchPage(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_Page *page = xten_helper_createPage(CPU, address);
+        if (page == NULL)
+        {
+            return;
+        }
+        uint32_t pageStart = address & ~(XTEN_PAGE_SIZE - 1);
+        bool watched = false;
+        for (uint32_t i = 0; i < XTEN_DBREAK_COUNT && !watched; i++)
+        {
+            if (CPU->dbreakc[i] & (XTEN_DBREAKC_LOAD | XTEN_DBREAKC_STORE))
+            {
+                uint32_t mask = CPU->dbreakc[i] | ~(uint32_t)XTEN_DBREAKC_MASK;
+                uint32_t start = CPU->dbreaka[i] & mask;
+                // a data breakpoint covers at most 64 bytes so it touches this page only if its first or last byte is on it
+                watched = ((start ^ pageStart) & ~(XTEN_PAGE_SIZE - 1)) == 0 || (((start + ~mask) ^ pageStart) & ~(XTEN_PAGE_SIZE - 1)) == 0;
+            }
+        }
+        page->flags = watched ? (page->flags | XTEN_PAGE_WATCH) : (page->flags & ~(uint32_t)XTEN_PAGE_WATCH);
+#ifdef XTEN_ENABLE_JIT
+        if (watched && (page->flags & XTEN_PAGE_CODE))
+        {
+            // literals folded into translated blocks would never reach the watchpoint
+            xten_invalidateCode(CPU, pageStart, XTEN_PAGE_SIZE);
+        }
+#endif
+    }
+
+    /**
+     * @brief Refreshes the watch flag of the pages a data breakpoint covers
+     */
+    static inline void xten_helper_refreshWatchRange(Xtensa_lx_CPU *CPU, uint32_t dbreaka, uint32_t dbreakc)
+    {
+        uint32_t mask = dbreakc | ~(uint32_t)XTEN_DBREAKC_MASK;
+        uint32_t start = dbreaka & mask;
+        xten_helper_refreshWatchPage(CPU, start);
+        xten_helper_refreshWatchPage(CPU, start + ~mask);
+    }
+
+    /**
+     * @brief Writes a DBREAKA or DBREAKC register the way WSR does
+     *
+     * Only the pages the old and new ranges cover change their XTEN_PAGE_WATCH flag so loads and stores everywhere else keep
+     * taking the fast path.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param sr uint32_t DBREAKA0_NUM..DBREAKA15_NUM or DBREAKC0_NUM..DBREAKC15_NUM
+     * @param value uint32_t value written
+     */
+    void xten_writeDBreak(Xtensa_lx_CPU *CPU, uint32_t sr, uint32_t value)
+    {
+        uint32_t i;
+        if (sr >= DBREAKA0_NUM && sr < DBREAKA0_NUM + XTEN_DBREAK_COUNT)
+        {
+            i = sr - DBREAKA0_NUM;
+        }
+        else if (sr >= DBREAKC0_NUM && sr < DBREAKC0_NUM + XTEN_DBREAK_COUNT)
+        {
+            i = sr - DBREAKC0_NUM;
+        }
+        else
+        {
+            return;
+        }
+        uint32_t oldAddress = CPU->dbreaka[i];
+        uint32_t oldControl = CPU->dbreakc[i];
+        if (sr < DBREAKC0_NUM)
+        {
+            CPU->dbreaka[i] = value;
+        }
+        else
+        {
+            CPU->dbreakc[i] = value & (XTEN_DBREAKC_MASK | XTEN_DBREAKC_LOAD | XTEN_DBREAKC_STORE);
+        }
+        xten_helper_refreshWatchRange(CPU, oldAddress, oldControl);
+        xten_helper_refreshWatchRange(CPU, CPU->dbreaka[i], CPU->dbreakc[i]);
+    }
+
+    /****************************************This section is for exceptions**************************************************************/
+
+    /**
+     * @brief Records that the instruction being executed is illegal
+     *
+     * There is no exception vector in the core architecture so EXCCAUSE and EPC1 are set the way the exception option would
+     * and xten_run stops after the instruction instead of carrying on with whatever comes next.
+     */
+    static inline void xten_helper_illegalInstruction(Xtensa_lx_CPU *CPU)
+    {
+        CPU->exccause = XTEN_EXCCAUSE_ILLEGAL_INSTRUCTION;
+        CPU->epc1 = CPU->PC;
+        CPU->stopReason = XTEN_STOP_ILLEGAL_INSTRUCTION;
+    }
+
+    /**
+     * @brief Handler the decode tables give opcodes that are reserved or not implemented
+     */
+    static inline void xten_helper_illegalOpcode(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        (void)opcode;
+        XTEN_DEBUG_PRINT("\n\tThis is an unimplemented or reserved opcode %06X.\n", opcode);
+        xten_helper_illegalInstruction(CPU);
+    }
+
+    /**
+     * @brief Handler the decode tables give CUST0 and CUST1 runs the first registered instruction matching the opcode
+     */
+    static inline void xten_helper_customInstruction(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        for (uint32_t i = 0; i < CPU->customInstructionCount; i++)
+        {
+            Xtensa_lx_CustomInstruction *custom = &CPU->customInstructions[i];
+            if ((opcode & custom->mask) == custom->match)
+            {
+                custom->function(CPU, opcode, custom->context);
+                return;
+            }
+        }
+        xten_helper_illegalOpcode(CPU, opcode);
+    }
+
+    /**
+     * @brief Reports an access to memory that does not exist
+     *
+     * Meant to be called from a MemoryReadCallback or MemoryWriteCallback when the address is outside anything the user
+     * emulates. EXCCAUSE, EXCVADDR and EPC1 are set and xten_run stops once the instruction finishes. A fault raised while the
+     * instruction itself is fetched stops xten_run before it runs with EXCCAUSE set to InstructionFetchErrorCause.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer passed to the callback
+     * @param address uint32_t address that was accessed
+     */
+    void xten_raiseMemoryFault(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        CPU->exccause = XTEN_EXCCAUSE_LOAD_STORE_ERROR;
+        CPU->excvaddr = address;
+        CPU->epc1 = CPU->PC;
+        CPU->stopReason = XTEN_STOP_MEMORY_FAULT;
+    }
+
+    /****************************************This section is for coverage**************************************************************/
+
+    /**
+     * @brief Turns edge coverage on or off
+     *
+     * While on xten_run adds one to a byte of the bitmap for every jump, call, return and branch taken or not taken the way
+     * AFL instrumented code does so the bitmap can be shared memory handed out by a fuzzer. Which instructions count is decided
+     * when they are decoded so turning coverage on or off invalidates the decode cache and costs nothing while off.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param bitmap uint8_t pointer to the hit counts or NULL to turn coverage off
+     * @param size uint32_t bytes in the bitmap must be a power of two
+     * @return bool false if size is not a power of two
+     */
+    bool xten_enableCoverage(Xtensa_lx_CPU *CPU, uint8_t *bitmap, uint32_t size)
+    {
+        if (bitmap != NULL && (size == 0 || (size & (size - 1)) != 0))
+        {
+            return false;
+        }
+        CPU->coverageMap = bitmap;
+        CPU->coverageMask = (bitmap == NULL) ? 0 : size - 1;
+        xten_invalidateAllCode(CPU);
+        return true;
+    }
+
+    /****************************************This section is for the fetch cache model**************************************************************/
+
+    /**
+     * @brief Turns the fetch cache model on or off
+     *
+     * While on xten_run charges missCycles to CCOUNT whenever an instruction is fetched from a line of the region that is not
+     * in the modelled XTEN_FETCH_CACHE_SIZE cache such as code running from SPI flash. The cache is only looked at when the
+     * program counter reaches a new line or after a jump so the cost is per line not per instruction. Like coverage which
+     * instructions look is decided when they are decoded so the model costs nothing while off but xten_run interprets while
+     * it is on. Turning it on starts with an empty cache and zeroed counts.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param base uint32_t first address of the cached region must be a multiple of XTEN_FETCH_CACHE_LINE
+     * @param size uint32_t bytes in the region or 0 to turn the model off
+     * @param missCycles uint32_t cycles a miss stalls for
+     * @param lines Xtensa_lx_LineStats pointer to size / XTEN_FETCH_CACHE_LINE counters zeroed by the user or NULL
+     * @return bool false if base is not aligned or the arena has no room for the tags
+     */
+    bool xten_enableFetchCache(Xtensa_lx_CPU *CPU, uint32_t base, uint32_t size, uint32_t missCycles, Xtensa_lx_LineStats *lines)
+    {
+        if ((base & (XTEN_FETCH_CACHE_LINE - 1)) != 0)
+        {
+            return false;
+        }
+        if (size != 0 && CPU->fetchCacheMemory == NULL)
+        {
+            CPU->fetchCacheMemory = (Xtensa_lx_FetchCache *)xten_arenaAlloc(CPU, sizeof(Xtensa_lx_FetchCache));
+            if (CPU->fetchCacheMemory == NULL)
+            {
+                return false;
+            }
+        }
+        CPU->fetchCache = NULL;
+        if (size != 0)
+        {
+            Xtensa_lx_FetchCache *cache = CPU->fetchCacheMemory;
+            memset(cache, 0, sizeof(Xtensa_lx_FetchCache));
+            cache->base = base;
+            cache->size = size;
+            cache->missCycles = missCycles;
+            cache->lastLine = 1; // no line address has the low bit set
+            cache->lines = lines;
+            CPU->fetchCache = cache;
+        }
+        xten_invalidateAllCode(CPU);
+        return true;
+    }
+
+    /**
+     * @brief Empties the modelled cache the way a cache flush by the firmware or a change of what the region shows would
+     */
+    void xten_flushFetchCache(Xtensa_lx_CPU *CPU)
+    {
+        if (CPU->fetchCache != NULL)
+        {
+            memset(CPU->fetchCache->tags, 0, sizeof(CPU->fetchCache->tags));
+            CPU->fetchCache->lastLine = 1;
+        }
+    }
+
+    /**
+     * @brief Adds up the hits and misses of the lines holding a range of addresses
+     *
+     * Meant to be called with the start and end of a function to see which functions stall on the cache. A line shared by
+     * two functions counts towards both. Needs the per line counters passed to xten_enableFetchCache.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer with the model on
+     * @param start uint32_t first address of the range
+     * @param end uint32_t address after the range
+     * @param *hits uint64_t pointer set to the hits in the range
+     * @param *misses uint64_t pointer set to the misses in the range
+     * @return bool false if the model is off or has no per line counters
+     */
+    bool xten_fetchCacheRangeStats(Xtensa_lx_CPU *CPU, uint32_t start, uint32_t end, uint64_t *hits, uint64_t *misses)
+    {
+        Xtensa_lx_FetchCache *cache = CPU->fetchCache;
+        *hits = 0;
+        *misses = 0;
+        if (cache == NULL || cache->lines == NULL)
+        {
+            return false;
+        }
+        for (uint64_t line = start & ~(uint32_t)(XTEN_FETCH_CACHE_LINE - 1); line < end; line += XTEN_FETCH_CACHE_LINE)
+        {
+            uint32_t offset = (uint32_t)line - cache->base;
+            if (offset < cache->size)
+            {
+                *hits += cache->lines[offset / XTEN_FETCH_CACHE_LINE].hits;
+                *misses += cache->lines[offset / XTEN_FETCH_CACHE_LINE].misses;
+            }
+        }
+        return true;
+    }
+
+    /****************************************This section is for the timing model**************************************************************/
+
+    /**
+     * @brief Turns the cycle approximate timing model on or off
+     *
+     * While on CCOUNT counts the stalls of a simple in order pipeline on top of one cycle per instruction. What an instruction
+     * costs no matter what it does such as a load followed by an instruction reading the loaded register or the extra cycle of
+     * L32R is worked out when it is decoded and translated blocks add it up for the whole block. A jump, call, return or
+     * branch that moves the program counter anywhere but the next instruction and reads or writes that miss the memory map
+     * are charged when they happen. Works together with the fetch cache model and costs nothing while off.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param timing Xtensa_lx_Timing pointer to the costs to use such as &xten_lx106Timing or NULL to turn the model off
+     */
+    void xten_setTiming(Xtensa_lx_CPU *CPU, const Xtensa_lx_Timing *timing)
+    {
+        memset(&CPU->timing, 0, sizeof(CPU->timing));
+        CPU->timingEnabled = timing != NULL;
+        if (timing != NULL)
+        {
+            CPU->timing = *timing;
+        }
+        xten_invalidateAllCode(CPU);
+    }
+
+    /****************************************This section is for instrumentation hooks**************************************************************/
+
+    /**
+     * @brief Installs or removes instrumentation hooks
+     *
+     * While any hooks are installed xten_step and xten_run call them from a loop of their own so the interpreter and the JIT
+     * never test for them and run at full speed when there are none. Changing hooks between calls to xten_run is fine.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param hooks Xtensa_lx_Hooks pointer copied into the CPU or NULL to remove every hook
+     */
+    void xten_setHooks(Xtensa_lx_CPU *CPU, const Xtensa_lx_Hooks *hooks)
+    {
+        memset(&CPU->hooks, 0, sizeof(CPU->hooks));
+        if (hooks != NULL)
+        {
+            CPU->hooks = *hooks;
+        }
+        CPU->hooksEnabled = CPU->hooks.preInstruction != NULL || CPU->hooks.postInstruction != NULL || CPU->hooks.memory != NULL ||
+                            CPU->hooks.branch != NULL || CPU->hooks.exception != NULL;
+    }
+
+    /****************************************This section is for statistics**************************************************************/
+#ifdef XTEN_ENABLE_STATS
+
+    /**
+     * @brief Zeroes every instruction mix counter
+     */
+    void xten_clearStats(Xtensa_lx_CPU *CPU)
+    {
+        memset(&CPU->stats, 0, sizeof(CPU->stats));
+    }
+
+    /**
+     * @brief Adds up the instructions run by one handler family
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param family uint32_t XTEN_FAMILY_* named by xten_familyNames
+     * @return uint64_t instructions of the family run since the counters were last cleared
+     */
+    uint64_t xten_statsFamily(Xtensa_lx_CPU *CPU, uint32_t family)
+    {
+        uint64_t total = 0;
+        for (uint32_t op = 0; op < XTEN_OP_COUNT; op++)
+        {
+            if (xten_opFamilies[op] == family)
+            {
+                total += CPU->stats.ops[op];
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Adds up the loads of one width
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param bytes uint32_t 1, 2 or 4
+     * @return uint64_t loads of that width including L32R run since the counters were last cleared
+     */
+    uint64_t xten_statsLoads(Xtensa_lx_CPU *CPU, uint32_t bytes)
+    {
+        uint64_t total = 0;
+        for (uint32_t op = 0; op < XTEN_OP_COUNT; op++)
+        {
+            if (xten_opFamilies[op] == XTEN_FAMILY_LOAD && xten_helper_accessWidth(op) == bytes)
+            {
+                total += CPU->stats.ops[op];
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Adds up the stores of one width
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param bytes uint32_t 1, 2 or 4
+     * @return uint64_t stores of that width run since the counters were last cleared
+     */
+    uint64_t xten_statsStores(Xtensa_lx_CPU *CPU, uint32_t bytes)
+    {
+        uint64_t total = 0;
+        for (uint32_t op = 0; op < XTEN_OP_COUNT; op++)
+        {
+            if (xten_opFamilies[op] == XTEN_FAMILY_STORE && xten_helper_accessWidth(op) == bytes)
+            {
+                total += CPU->stats.ops[op];
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Writes the instruction mix as text
+     *
+     * Every instruction that ran is listed with its count and share of the total followed by the families, the branch taken
+     * ratio and the load and store widths.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param out FILE pointer to write to such as stdout
+     */
+    void xten_printStats(Xtensa_lx_CPU *CPU, FILE *out)
+    {
+        uint64_t total = 0;
+        for (uint32_t op = 0; op < XTEN_OP_COUNT; op++)
+        {
+            total += CPU->stats.ops[op];
+        }
+        double scale = (total == 0) ? 0.0 : 100.0 / (double)total;
+        fprintf(out, "instructions %llu\n", (unsigned long long)total);
+        for (uint32_t op = 0; op < XTEN_OP_COUNT; op++)
+        {
+            if (CPU->stats.ops[op] != 0)
+            {
+                fprintf(out, "\t%-10s %12llu %6.2f%%\n", xten_opNames[op], (unsigned long long)CPU->stats.ops[op], (double)CPU->stats.ops[op] * scale);
+            }
+        }
+        fprintf(out, "families\n");
+        for (uint32_t family = 0; family < XTEN_FAMILY_COUNT; family++)
+        {
+            uint64_t count = xten_statsFamily(CPU, family);
+            if (count != 0)
+            {
+                fprintf(out, "\t%-18s %12llu %6.2f%%\n", xten_familyNames[family], (unsigned long long)count, (double)count * scale);
+            }
+        }
+        uint64_t branches = CPU->stats.branchesTaken + CPU->stats.branchesNotTaken;
+        fprintf(out, "branches %llu taken %llu not taken %llu taken %.2f%%\n", (unsigned long long)branches,
+                (unsigned long long)CPU->stats.branchesTaken, (unsigned long long)CPU->stats.branchesNotTaken,
+                (branches == 0) ? 0.0 : 100.0 * (double)CPU->stats.branchesTaken / (double)branches);
+        for (uint32_t bytes = 1; bytes <= 4; bytes *= 2)
+        {
+            fprintf(out, "%u byte loads %llu stores %llu\n", bytes, (unsigned long long)xten_statsLoads(CPU, bytes),
+                    (unsigned long long)xten_statsStores(CPU, bytes));
+        }
+    }
+
+#endif
+
+    /****************************************This section is for native functions**************************************************************/
+
+    /**
+     * @brief Finds the native function registered for a call target
+     *
+     * @return Xtensa_lx_NativeFunction pointer or NULL when the target runs as guest code
+     */
+    static inline Xtensa_lx_NativeFunction *xten_helper_findNative(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        uint32_t low = 0;
+        uint32_t high = CPU->nativeFunctionCount;
+        while (low < high)
+        {
+            uint32_t middle = (low + high) / 2;
+            if (CPU->nativeFunctions[middle].address < address)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return (low < CPU->nativeFunctionCount && CPU->nativeFunctions[low].address == address) ? &CPU->nativeFunctions[low] : NULL;
+    }
+
+    /**
+     * @brief Runs the native function for a call target if there is one
+     *
+     * Called by CALL0 and CALLX0 after they set a0 so the call returns to the instruction after it once the function ran.
+     *
+     * @return bool true when host code ran and the call must not enter the target
+     */
+    static inline bool xten_helper_callNative(Xtensa_lx_CPU *CPU, uint32_t target)
+    {
+        if (CPU->nativeFunctionCount == 0)
+        {
+            return false;
+        }
+        Xtensa_lx_NativeFunction *native = xten_helper_findNative(CPU, target);
+        if (native == NULL)
+        {
+            return false;
+        }
+        native->function(CPU, native->context);
+        return true;
+    }
+
+    /**
+     * @brief Argument n of a call0 function a2 to a7 then the words the caller left at the stack pointer
+     */
+    static inline uint32_t xten_nativeArgument(Xtensa_lx_CPU *CPU, uint32_t n)
+    {
+        if (n < 6)
+        {
+            return CPU->registerFile[CPU->windowOffset + 2 + n];
+        }
+        return xten_readMemory(CPU, CPU->registerFile[CPU->windowOffset + 1] + (n - 6) * 4);
+    }
+
+    /**
+     * @brief 64 bit argument held in arguments n and n + 1
+     *
+     * The first register of the pair holds the most significant word on a big endian core and the least significant on a
+     * little endian one the way the compiler splits 64 bit values.
+     */
+    static inline uint64_t xten_nativeArgument64(Xtensa_lx_CPU *CPU, uint32_t n)
+    {
+        uint64_t first = xten_nativeArgument(CPU, n);
+        uint64_t second = xten_nativeArgument(CPU, n + 1);
+        return CPU->msbFirstOption ? (first << 32) | second : (second << 32) | first;
+    }
+
+    /**
+     * @brief Sets a2 the call0 return value
+     */
+    static inline void xten_nativeReturn(Xtensa_lx_CPU *CPU, uint32_t value)
+    {
+        CPU->registerFile[CPU->windowOffset + 2] = value;
+    }
+
+    /**
+     * @brief Sets a2 and a3 to a 64 bit return value ordered like xten_nativeArgument64
+     */
+    static inline void xten_nativeReturn64(Xtensa_lx_CPU *CPU, uint64_t value)
+    {
+        CPU->registerFile[CPU->windowOffset + 2] = (uint32_t)(CPU->msbFirstOption ? value >> 32 : value);
+        CPU->registerFile[CPU->windowOffset + 3] = (uint32_t)(CPU->msbFirstOption ? value : value >> 32);
+    }
+
+    /**
+     * @brief Runs host code instead of the guest function at an address
+     *
+     * Every CALL0 and CALLX0 to address runs function and returns through a0 at once so a ROM routine or a hot library
+     * function costs one instruction and does not have to be in guest memory at all. Jumps that reach the address any
+     * other way still run the guest code. Registering an address again replaces its function.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param address uint32_t entry point of the guest function
+     * @param function NativeFunctionCallback to run instead
+     * @param context pointer handed to function
+     * @return bool false if the table is full
+     */
+    bool xten_addNativeFunction(Xtensa_lx_CPU *CPU, uint32_t address, NativeFunctionCallback function, void *context)
+    {
+        Xtensa_lx_NativeFunction *native = xten_helper_findNative(CPU, address);
+        if (native == NULL)
+        {
+            if (CPU->nativeFunctionCount == XTEN_MAX_NATIVE_FUNCTIONS)
+            {
+                return false;
+            }
+            uint32_t index = 0;
+            while (index < CPU->nativeFunctionCount && CPU->nativeFunctions[index].address < address)
+            {
+                index++;
+            }
+            native = &CPU->nativeFunctions[index];
+            memmove(native + 1, native, (CPU->nativeFunctionCount - index) * sizeof(Xtensa_lx_NativeFunction));
+            CPU->nativeFunctionCount++;
+        }
+        native->address = address;
+        native->function = function;
+        native->context = context;
+        return true;
+    }
+
+    /**
+     * @brief Lets calls to an address run the guest code again
+     *
+     * @return bool false if no native function was registered there
+     */
+    bool xten_removeNativeFunction(Xtensa_lx_CPU *CPU, uint32_t address)
+    {
+        Xtensa_lx_NativeFunction *native = xten_helper_findNative(CPU, address);
+        if (native == NULL)
+        {
+            return false;
+        }
+        uint32_t index = (uint32_t)(native - CPU->nativeFunctions);
+        memmove(native, native + 1, (CPU->nativeFunctionCount - index - 1) * sizeof(Xtensa_lx_NativeFunction));
+        CPU->nativeFunctionCount--;
+        return true;
+    }
+
+    /****************************************This section is for TIE extensions**************************************************************/
+
+    /**
+     * @brief Configures a user register so RUR and WUR can reach it
+     *
+     * RUR and WUR naming a user register nobody added raise an illegal instruction exception like on a core without it.
+     * The value starts at zero and lives in CPU->userRegisters where custom instructions and the host can use it directly.
+     * Snapshots save and restore it.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param number uint32_t user register number 0 to 255
+     * @return bool false if number is out of range
+     */
+    bool xten_addUserRegister(Xtensa_lx_CPU *CPU, uint32_t number)
+    {
+        if (number >= XTEN_USER_REGISTER_COUNT)
+        {
+            return false;
+        }
+        if (!(CPU->userRegisterMask[number / 32] & (1U << (number % 32))))
+        {
+            CPU->userRegisterMask[number / 32] |= 1U << (number % 32);
+            CPU->userRegisterCount++;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Makes opcodes in the CUST0 and CUST1 groups run a host function
+     *
+     * An opcode runs the first added instruction whose mask and match fit it and raises an illegal instruction exception
+     * if none does. The decode tables send the whole groups to one handler so adding instructions never invalidates
+     * anything and translated code calls them like any other handler. match and mask are in the layout of the CPU byte
+     * order so set it before adding instructions. mask has to cover op0 and op1 and they have to name CUST0 or CUST1.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer
+     * @param match uint32_t opcode bits that identify the instruction
+     * @param mask uint32_t which bits of an opcode are compared with match
+     * @param function CustomInstructionCallback executing the instruction
+     * @param context pointer handed to function
+     * @return bool false if the table is full or match is not a CUST0 or CUST1 opcode
+     */
+    bool xten_addCustomInstruction(Xtensa_lx_CPU *CPU, uint32_t match, uint32_t mask, CustomInstructionCallback function, void *context)
+    {
+        uint32_t op0Shift = CPU->msbFirstOption ? 20 : 0;
+        uint32_t op1Shift = CPU->msbFirstOption ? 4 : 16;
+        uint32_t fields = (0x0FU << op0Shift) | (0x0FU << op1Shift);
+        uint32_t op1 = (match >> op1Shift) & 0x0F;
+        if (CPU->customInstructionCount == XTEN_MAX_CUSTOM_INSTRUCTIONS || (mask & fields) != fields || (match & ~mask) != 0 ||
+            ((match >> op0Shift) & 0x0F) != 0x0 || (op1 != 0x6 && op1 != 0x7))
+        {
+            return false;
+        }
+        Xtensa_lx_CustomInstruction *custom = &CPU->customInstructions[CPU->customInstructionCount++];
+        custom->match = match;
+        custom->mask = mask;
+        custom->function = function;
+        custom->context = context;
+        return true;
+    }
+
+    /****************************************This section is for lockstep checking**************************************************************/
+
+    /**
+     * @brief struct pairing a CPU with a reference CPU that checks it one block of instructions at a time
+     */
+    typedef struct Xtensa_lx_Lockstep
+    {
+        Xtensa_lx_CPU *CPU;                                            // CPU run by the engine being checked
+        Xtensa_lx_CPU *reference;                                      // CPU run through xten_executeNext with a fresh fetch every instruction
+        uint32_t (*run)(Xtensa_lx_CPU *CPU, uint32_t maxInstructions); // engine being checked xten_run unless changed
+        Xtensa_lx_AccessLog fastLog;                                   // accesses of the checked engine for the current block
+        Xtensa_lx_AccessLog referenceLog;                              // stores the reference made for the current block
+        uint32_t fastReadsUsed;                                        // callback reads the reference has taken from fastLog
+        uint64_t checked;                                              // instructions that matched
+        bool diverged;                                                 // set at the first mismatch nothing runs after that
+        uint32_t divergencePC;                                         // address of the first instruction of the block that did not match
+        char report[XTEN_LOCKSTEP_REPORT_SIZE];                        // what did not match
+    } Xtensa_lx_Lockstep;
+
+    /**
+     * @brief Puts one store of an access log over four bytes read at an address
+     */
+    static inline uint32_t xten_helper_lockstepOverlay(uint32_t value, uint32_t address, const Xtensa_lx_MemoryAccess *access, uint32_t bytes)
+    {
+        for (int i = 0; i < access->numBytes; i++)
+        {
+            uint32_t at = access->address + (uint32_t)i - address;
+            if (at < 4)
+            {
+                uint32_t shift = 8 * (3 - at);
+                uint32_t byte = (bytes >> (8 * (access->numBytes - 1 - i))) & 0xFF;
+                value = (value & ~((uint32_t)0xFF << shift)) | (byte << shift);
+            }
+        }
+        return value;
+    }
+
+    /**
+     * @brief Checks whether a store lands in host memory rather than going to the write callback
+     *
+     * Follows xten_helper_writePage so a store starting in a writable page counts even when it crosses into the next page.
+     */
+    static inline bool xten_helper_lockstepHostStore(Xtensa_lx_CPU *CPU, const Xtensa_lx_MemoryAccess *store)
+    {
+        Xtensa_lx_Page *page = xten_lookupPage(CPU, store->address);
+        return page != NULL && (page->flags & (XTEN_PAGE_WRITE | XTEN_PAGE_SNAPSHOT));
+    }
+
+    /**
+     * @brief Reads memory for the reference CPU
+     *
+     * Host memory is read from the checked CPU which has already run the whole block so its stores are undone newest first
+     * and the stores the reference made to host memory so far in the block put back on top. Anything behind the callbacks is taken from
+     * what the checked engine read so devices only see each access once.
+     */
+    static inline uint32_t xten_helper_lockstepRead(Xtensa_lx_CPU *reference, uint32_t address, void *context)
+    {
+        (void)reference;
+        Xtensa_lx_Lockstep *lockstep = (Xtensa_lx_Lockstep *)context;
+        if (xten_helper_hostReadable(lockstep->CPU, address, 4))
+        {
+            uint32_t value = xten_readMemory(lockstep->CPU, address);
+            for (uint32_t i = lockstep->fastLog.writeCount; i-- > 0;)
+            {
+                value = xten_helper_lockstepOverlay(value, address, &lockstep->fastLog.writes[i], lockstep->fastLog.writes[i].previous);
+            }
+            for (uint32_t i = 0; i < lockstep->referenceLog.writeCount; i++)
+            {
+                Xtensa_lx_MemoryAccess *store = &lockstep->referenceLog.writes[i];
+                if (xten_helper_lockstepHostStore(lockstep->CPU, store))
+                {
+                    value = xten_helper_lockstepOverlay(value, address, store, store->value);
+                }
+            }
+            return value;
+        }
+        for (uint32_t i = lockstep->fastReadsUsed; i < lockstep->fastLog.readCount; i++)
+        {
+            if (lockstep->fastLog.reads[i].address == address)
+            {
+                lockstep->fastReadsUsed = i + 1;
+                return lockstep->fastLog.reads[i].value;
+            }
+        }
+        if (!lockstep->diverged)
+        {
+            lockstep->diverged = true;
+            snprintf(lockstep->report, sizeof(lockstep->report), "reference read %08X which the checked engine did not", address);
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Logs a store of the reference CPU without doing it
+     */
+    static inline void xten_helper_lockstepWrite(Xtensa_lx_CPU *reference, uint32_t address, uint32_t value, int numBytes, void *context)
+    {
+        (void)reference;
+        Xtensa_lx_AccessLog *log = &((Xtensa_lx_Lockstep *)context)->referenceLog;
+        xten_helper_logAccess(log->writes, &log->writeCount, address, value, 0, numBytes);
+    }
+
+    /**
+     * @brief Fetches the next instruction for the reference CPU
+     *
+     * Host memory is read the way xten_helper_lockstepRead sees it so stale decodes in the checked engine are caught. Code
+     * behind the callbacks comes from the fetch the checked engine logged or from its decode cache when it did not fetch again.
+     */
+    static inline uint32_t xten_helper_lockstepFetch(Xtensa_lx_Lockstep *lockstep, uint32_t pc)
+    {
+        if (xten_helper_hostReadable(lockstep->CPU, pc, 4))
+        {
+            return xten_helper_lockstepRead(lockstep->reference, pc, lockstep) >> 8;
+        }
+        for (uint32_t i = lockstep->fastReadsUsed; i < lockstep->fastLog.readCount; i++)
+        {
+            if (lockstep->fastLog.reads[i].address == pc)
+            {
+                lockstep->fastReadsUsed = i + 1;
+                return lockstep->fastLog.reads[i].value >> 8;
+            }
+        }
+        return xten_fetchEntry(lockstep->CPU, pc)->opcode;
+    }
+
+    /**
+     * @brief Pairs a CPU with a reference CPU for lockstep checking
+     *
+     * The reference CPU has no memory map and no decode cache so every instruction is fetched again and executed by the
+     * original decoder. It is only ever brought up to date from the checked CPU so it never has to be kept in sync by hand.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to check
+     * @return Xtensa_lx_Lockstep pointer or NULL if allocation fails
+     */
+    Xtensa_lx_Lockstep *xten_createLockstep(Xtensa_lx_CPU *CPU)
+    {
+        size_t referenceSize = xten_cpuFootprint(0);
+        Xtensa_lx_Lockstep *lockstep = (Xtensa_lx_Lockstep *)calloc(1, XTEN_ALIGN_UP(sizeof(Xtensa_lx_Lockstep)) + referenceSize + XTEN_ARENA_ALIGNMENT);
+        if (lockstep == NULL)
+        {
+            return NULL;
+        }
+        void *block = (void *)XTEN_ALIGN_UP((size_t)lockstep + sizeof(Xtensa_lx_Lockstep));
+        lockstep->reference = xten_initCPUInPlace(block, referenceSize, xten_helper_lockstepRead, xten_helper_lockstepWrite, lockstep);
+        if (lockstep->reference == NULL)
+        {
+            free(lockstep);
+            return NULL;
+        }
+        lockstep->CPU = CPU;
+        lockstep->run = xten_run;
+        return lockstep;
+    }
+
+    static inline void xten_freeLockstep(Xtensa_lx_Lockstep *lockstep)
+    {
+        free(lockstep); // the reference CPU lives in the same allocation
+    }
+
+    /**
+     * @brief Compares the checked CPU with the reference after a block
+     */
+    static inline bool xten_helper_lockstepCompare(Xtensa_lx_Lockstep *lockstep, uint32_t count)
+    {
+        Xtensa_lx_CPU *CPU = lockstep->CPU;
+        Xtensa_lx_CPU *reference = lockstep->reference;
+        char *report = lockstep->report;
+        size_t size = sizeof(lockstep->report);
+        int used = snprintf(report, size, "block at PC %08X of %u instructions: ", lockstep->divergencePC, count);
+        report += used;
+        size -= (size_t)used;
+
+        for (uint32_t i = 0; i < DEFAULT_REGISTER_FILE_SIZE; i++)
+        {
+            if (CPU->registerStorage[i] != reference->registerStorage[i])
+            {
+                snprintf(report, size, "a%u is %08X but reference has %08X", i, CPU->registerStorage[i], reference->registerStorage[i]);
+                return false;
+            }
+        }
+        if (CPU->PC != reference->PC)
+        {
+            snprintf(report, size, "PC is %08X but reference has %08X", CPU->PC, reference->PC);
+            return false;
+        }
+        if (CPU->sar != reference->sar)
+        {
+            snprintf(report, size, "SAR is %u but reference has %u", CPU->sar, reference->sar);
+            return false;
+        }
+        for (uint32_t i = 0; CPU->userRegisterCount != 0 && i < XTEN_USER_REGISTER_COUNT; i++)
+        {
+            if (CPU->userRegisters[i] != reference->userRegisters[i])
+            {
+                snprintf(report, size, "user register %u is %08X but reference has %08X", i, CPU->userRegisters[i], reference->userRegisters[i]);
+                return false;
+            }
+        }
+        if (lockstep->fastLog.writeCount != lockstep->referenceLog.writeCount)
+        {
+            snprintf(report, size, "%u stores but reference made %u", lockstep->fastLog.writeCount, lockstep->referenceLog.writeCount);
+            return false;
+        }
+        for (uint32_t i = 0; i < lockstep->fastLog.writeCount; i++)
+        {
+            Xtensa_lx_MemoryAccess *fast = &lockstep->fastLog.writes[i];
+            Xtensa_lx_MemoryAccess *expected = &lockstep->referenceLog.writes[i];
+            if (fast->address != expected->address || fast->value != expected->value || fast->numBytes != expected->numBytes)
+            {
+                snprintf(report, size, "stored %08X to %08X (%d bytes) but reference stored %08X to %08X (%d bytes)", fast->value,
+                         fast->address, fast->numBytes, expected->value, expected->address, expected->numBytes);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Runs one block on both engines and compares them
+     *
+     * The checked engine runs up to maxInstructions through lockstep->run so the JIT, the threaded interpreter and
+     * superinstructions are what gets checked, logging its stores and callback reads. The reference then runs as many
+     * instructions one at a time from a copy of the state before the block, each fetched again from memory as it was when
+     * that instruction ran. Registers, PC, SAR and stores have to match at the end of the block.
+     *
+     * @return uint32_t instructions the checked engine ran
+     */
+    static inline uint32_t xten_helper_lockstepBlock(Xtensa_lx_Lockstep *lockstep, uint32_t maxInstructions)
+    {
+        Xtensa_lx_CPU *CPU = lockstep->CPU;
+        Xtensa_lx_CPU *reference = lockstep->reference;
+
+        // bring the reference up to the state the checked CPU is in before the block
+        memcpy(reference->registerStorage, CPU->registerStorage, sizeof(reference->registerStorage));
+        reference->windowOffset = CPU->windowOffset;
+        reference->PC = CPU->PC;
+        reference->sar = CPU->sar;
+        reference->msbFirstOption = CPU->msbFirstOption;
+        reference->ccount = CPU->ccount;
+        reference->interrupt = CPU->interrupt;
+        reference->intenable = CPU->intenable;
+        reference->stopReason = XTEN_STOP_NONE;
+        if (CPU->userRegisterCount != 0 || CPU->customInstructionCount != 0)
+        {
+            // custom instructions run on both engines so their functions should only change CPU state
+            memcpy(reference->userRegisters, CPU->userRegisters, sizeof(reference->userRegisters));
+            memcpy(reference->userRegisterMask, CPU->userRegisterMask, sizeof(reference->userRegisterMask));
+            memcpy(reference->customInstructions, CPU->customInstructions, sizeof(reference->customInstructions));
+            reference->customInstructionCount = CPU->customInstructionCount;
+        }
+        lockstep->divergencePC = CPU->PC;
+
+        memset(&lockstep->fastLog, 0, sizeof(lockstep->fastLog));
+        memset(&lockstep->referenceLog, 0, sizeof(lockstep->referenceLog));
+        lockstep->fastReadsUsed = 0;
+        CPU->accessLog = &lockstep->fastLog;
+        uint32_t executed = lockstep->run(CPU, maxInstructions);
+        CPU->accessLog = NULL;
+
+        for (uint32_t i = 0; i < executed && !lockstep->diverged; i++)
+        {
+            reference->dataBus = xten_helper_lockstepFetch(lockstep, reference->PC) << 8;
+            xten_executeNext(reference);
+        }
+
+        if (lockstep->diverged || !xten_helper_lockstepCompare(lockstep, executed))
+        {
+            lockstep->diverged = true;
+            return executed;
+        }
+        lockstep->report[0] = '\0';
+        lockstep->checked += executed;
+        return executed;
+    }
+
+    /**
+     * @brief Runs one instruction on both engines and compares them
+     *
+     * A block of one instruction so a divergence found by xten_lockstepRun can be narrowed down to the instruction.
+     *
+     * @param *lockstep Xtensa_lx_Lockstep pointer
+     * @return bool false once the engines have diverged lockstep->report says how
+     */
+    bool xten_lockstepStep(Xtensa_lx_Lockstep *lockstep)
+    {
+        if (lockstep->diverged)
+        {
+            return false;
+        }
+        xten_helper_lockstepBlock(lockstep, 1);
+        return !lockstep->diverged;
+    }
+
+    /**
+     * @brief Runs up to a number of instructions in lockstep
+     *
+     * The engines are compared every XTEN_LOCKSTEP_BLOCK instructions and wherever the checked CPU stops so
+     * lockstep->divergencePC names the start of the block that did not match.
+     *
+     * @param *lockstep Xtensa_lx_Lockstep pointer
+     * @param maxInstructions uint32_t most instructions to run
+     * @return uint32_t instructions that matched stops at the first divergence or when the checked CPU stops
+     */
+    uint32_t xten_lockstepRun(Xtensa_lx_Lockstep *lockstep, uint32_t maxInstructions)
+    {
+        uint32_t executed = 0;
+        while (executed < maxInstructions && lockstep->CPU->chipEnable == XTEN_HIGH && !lockstep->diverged)
+        {
+            uint32_t budget = maxInstructions - executed < XTEN_LOCKSTEP_BLOCK ? maxInstructions - executed : XTEN_LOCKSTEP_BLOCK;
+            uint32_t ran = xten_helper_lockstepBlock(lockstep, budget);
+            if (lockstep->diverged)
+            {
+                break;
+            }
+            executed += ran;
+            if (ran == 0 || lockstep->CPU->stopReason != XTEN_STOP_NONE)
+            {
+                break;
+            }
+        }
+        return executed;
+    }
+
+    /****************************************This section is for decoding**************************************************************/
+
+    // array for easy decoding of the r field special values
+    uint32_t xten_table317[16] = {0xFFFFFFFF, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007, 0x00000008, 0x0000000A, 0x0000000C, 0x00000010, 0x00000020, 0x00000040, 0x00000080, 0x00000100};
+
+    /**
+     * @brief This decodes the passed in opcode fetched for the passed in CPU
+     *
+     * This function takes an Xtensa_lx_CPU and the opcode fetched for that CPU decodes and sends the opcode to be executed further
+     * down the pipeline or to further decoding steps.
+     *
+     * @param CPU address of the Xtensa CPU
+     * @param opcode uint32_t of the opcode the CPU should execute
+     */
+    static inline void xten_decodeOp0(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // extract op0 keep in mind all core opcodes are actually 24 bits in size
+        // op0 in all core opcodes when big endian is set
+        uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0x0F;
+#ifdef XTEN_DEBUGGING
+        printf("PC %X opcode %X:\n", CPU->PC, opcode);
+#endif
+#ifdef XTEN_DEBUGGING_DETAILED
+        printf("At CPU->PC %X opcode %X op0 was found to be %X:\n", CPU->PC, opcode, op0);
+#endif
+        switch (op0 >> 2)
+        {
+        case 0x0:
+            switch (op0)
+            {
+            case 0x0:
+                // entering table decoding QRST193
+                xten_decodeQRST(CPU, opcode);
+                break;
+            case 0x1:
+                // goes to the L32R instruction
+                xten_coreLoadInstructions(CPU, opcode);
                 break;
             case 0x2:
                 // entering table decoding LSAI216
@@ -342,9 +5040,11 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             default:
-                printf("\nsomething went wrong the switch could not find the op0 after finding it started with the prefix zero opcode is %8x \n", op0);
+                XTEN_DEBUG_PRINT("\nsomething went wrong the switch could not find the op0 after finding it started with the prefix zero opcode is %8x \n", op0);
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
             break;
@@ -355,6 +5055,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             case 0x5:
                 // entering table decoding CALLN 7-232
@@ -374,16 +5075,19 @@ extern "C"
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         case 0x3:
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         default:
 #ifdef XTEN_DEBUGGING
             printf("\tImpossible opcode encountered something went wrong with decoding logic.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         }
     }
@@ -423,6 +5127,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             case 0x3:
                 // RST3 table 7-210
@@ -446,12 +5151,14 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis hits the designer designed opcode table.\n");
 #endif
+                xten_helper_customInstruction(CPU, opcode);
                 break;
             case 0x7:
                 // CUST1 table 7.3.2 reserved for designer designed opcodes
 #ifdef XTEN_DEBUGGING
                 printf("\tThis hits the designer designed opcode table.\n");
 #endif
+                xten_helper_customInstruction(CPU, opcode);
                 break;
             }
             break;
@@ -459,16 +5166,19 @@ extern "C"
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         case 0x3:
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         default:
 #ifdef XTEN_DEBUGGING
             printf("\tImpossible opcode encountered something went wrong with decoding logic.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         }
     }
@@ -501,6 +5211,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
         }
     }
 
@@ -532,6 +5243,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
         }
     }
 
@@ -561,6 +5273,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
             }
             else
             {
@@ -574,6 +5287,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
             }
             else
             {
@@ -587,6 +5301,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             case 0x9:
                 // L16SI instruction
@@ -600,6 +5315,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
             break;
@@ -613,12 +5329,14 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
             }
             break;
         default:
 #ifdef XTEN_DEBUGGING
             printf("\tImpossible opcode encountered something went wrong with decoding logic.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         }
     }
@@ -654,10 +5372,10 @@ extern "C"
                     switch (m)
                     {
                     case 0x0:
-                        // ILL unimplemented
-                        break;
+                        // ILL always raises the illegal instruction exception
                     case 0x1:
                         // unimplemented
+                        xten_helper_illegalInstruction(CPU);
                         break;
                     case 0x2:
                         // JR table 197 reserved or unimplemented based on n or goes to following function set
@@ -675,6 +5393,16 @@ extern "C"
                     uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
                     switch (t)
                     {
+                    case 0x0:
+                        // ISYNC
+                    case 0x1:
+                        // RSYNC
+                    case 0x2:
+                        // ESYNC
+                    case 0x3:
+                        // DSYNC
+                        xten_coreProcessorControlInstructions(CPU, opcode);
+                        break;
                     case 0xC:
                         xten_coreMemoryOrderingInstructions(CPU, opcode);
                         break;
@@ -685,6 +5413,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                         printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                        xten_helper_illegalInstruction(CPU);
                         break;
                     }
                 }
@@ -693,6 +5422,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                     printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                    xten_helper_illegalInstruction(CPU);
                 }
             }
             else
@@ -711,6 +5441,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             case 0x6:
                 // RT0 table 204 used if s = 0x0000 NEG 0x0001 ABS otherwise reserved
@@ -724,12 +5455,14 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                     printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                    xten_helper_illegalInstruction(CPU);
                 }
                 break;
             case 0x7:
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
             break;
@@ -745,6 +5478,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
             printf("\tImpossible opcode encountered something went wrong with decoding logic.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         }
     }
@@ -783,6 +5517,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             case 0x6:
                 // XSR instruction
@@ -793,6 +5528,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
             break;
@@ -807,11 +5543,13 @@ extern "C"
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         default:
 #ifdef XTEN_DEBUGGING
             printf("\tImpossible opcode encountered something went wrong with decoding logic.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         }
     }
@@ -847,6 +5585,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
             }
             break;
         case 0x1:
@@ -854,6 +5593,7 @@ extern "C"
 #ifdef XTEN_DEBUGGING
             printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         case 0x2:
             // all implemented move instructions
@@ -870,18 +5610,113 @@ extern "C"
 #ifdef XTEN_DEBUGGING
                 printf("\tThis is an unimplemented or reserved opcode.\n");
 #endif
+                xten_helper_illegalInstruction(CPU);
             }
             break;
         default:
 #ifdef XTEN_DEBUGGING
             printf("\tImpossible opcode encountered something went wrong with decoding logic.\n");
 #endif
+            xten_helper_illegalInstruction(CPU);
             break;
         }
     }
 
     /*******************************************End of decoding section***********************************************************************/
 
+    static inline void xten_coreL32R(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // L32R      load literal at offset from CPU->PC(32 bit load CPU->PC relative(16 bit negative word offset))   RI16
+        // major opcode 0001     no sub opcode for this one
+        // CPU->PC relative 32 bit load
+        // address formed by adding 16 bit one extended constant value shifted left by two
+        // to teh address of teh L32R plus three with the two least significant bits cleared
+        // specifies 32-bit aligned addresses from -262141 to -4 bytes from the address of teh L32R instruction
+        // 32 bits are read from the address and written to at
+        // one of few memory instrucitons that can access instruction RAM/ROM
+        XTEN_DEBUG_PRINT("\n\tThe instruction is L32R\n");
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        // Now we calculate the address for the L32R instruction
+        uint16_t constValue = (opcode >> (CPU->msbFirstOption ? 0 : 8)) & 0xFFFF;
+        int32_t oneExtendedConst = (int16_t)constValue;
+        uint32_t address = (CPU->PC + 3 + (oneExtendedConst << 2)) & 0xFFFFFFFC;
+        // we recieve the value for the instruction to load and manipulate as nessecerry
+        uint32_t value = xten_loadMemory(CPU, address, 4);
+        XTEN_DEBUG_PRINT("\naddress is %8X and value to be assigned from that address is %8X\n", address, value);
+        CPU->registerFile[CPU->windowOffset + t] = value;
+    }
+
+    static inline void xten_coreL8UI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // L8UI      load zero-extended byte(8 bit unsigned load(8 bit offset))                             RRI8
+        // major opcode 0010     4-bit sub opcode in r 0000
+        // adds contents of register represented by s to 8 bit immediate
+        // data at memory address represented by this addition is then stored
+        // in register represented by t zero extended
+        XTEN_DEBUG_PRINT("\n\tThe instruction is L8UI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
+        uint32_t address = CPU->registerFile[CPU->windowOffset + s] + imm8;
+        uint32_t value = xten_loadMemory(CPU, address, 1) >> 24; // only 8 bits are read zero extended
+        XTEN_DEBUG_PRINT("\naddress is %8X and value to be assigned from that address is %8X\n", address, value);
+        CPU->registerFile[CPU->windowOffset + t] = value;
+    }
+
+    static inline void xten_coreL16SI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // L16SI     load signed extended 16 bit quantity(16 bit signed load(8 bit shifted offset))         RRI8
+        // major opcode 0010     4-bit sub opcode stored in r 1001
+        // 8 bit constant added to register represented by s shifted left by 1
+        // 16 bits two bytes read from register at the memory location this makes the value
+        // sign extended and then stored in register represented by t
+        // without unaligned exception option least significant address bit is ignored
+        // essentially subtract one from odd addresses before accessing
+        XTEN_DEBUG_PRINT("\n\tThe instruction is L16SI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
+        uint32_t address = CPU->registerFile[CPU->windowOffset + s] + (imm8 << 1);
+        uint32_t value = xten_loadMemory(CPU, address, 2) >> 16; // only 16 bits are read sign extended
+        value = xten_helper_signExtend32Bits(value, 16);
+        XTEN_DEBUG_PRINT("\naddress is %8X and value to be assigned from that address is %8X\n", address, value);
+        CPU->registerFile[CPU->windowOffset + t] = value;
+    }
+
+    static inline void xten_coreL16UI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // L16UI     load zero extended 16 bit quantity(16 bit unsigned load(8 bit shifted offset))         RRI8
+        // major opcode 0010     4-bit sub opcode stored in r 0001
+        // adds as and 8 bit immediate shifted left by 1
+        // reads in data like in L16SI except the data is zero extended instead of sign extened
+        XTEN_DEBUG_PRINT("\n\tThe instruction is L16UI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
+        uint32_t address = CPU->registerFile[CPU->windowOffset + s] + (imm8 << 1);
+        uint32_t value = xten_loadMemory(CPU, address, 2) >> 16; // only 16 bits are read sign extended
+        XTEN_DEBUG_PRINT("\naddress is %8X and value to be assigned from that address is %8X\n", address, value);
+        CPU->registerFile[CPU->windowOffset + t] = value;
+    }
+
+    static inline void xten_coreL32I(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // L32I      load 32 bit quantity(32 bit load(8 bit shifted offset))                                RRI8
+        // major opcode 0010     4-bit sub opcode stored in r 0010
+        // adds register as and 8 bit zero extended constant shifted left by 2
+        // reads address this represents 4 bytes of it written to register at
+        // this instruction ignores least significant two bits of the address calculated
+        // without unaligned exception option
+        XTEN_DEBUG_PRINT("\n\tThe instruction is L32I\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
+        uint32_t address = CPU->registerFile[CPU->windowOffset + s] + (imm8 << 2);
+        uint32_t value = xten_loadMemory(CPU, address, 4);
+        XTEN_DEBUG_PRINT("\naddress is %8X and value to be assigned from that address is %8X\n", address, value);
+        CPU->registerFile[CPU->windowOffset + t] = value;
+    }
+
     static inline void xten_coreLoadInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode)
     {
 
@@ -889,265 +5724,522 @@ extern "C"
         // RRI8 is [4 bit major opcode][4 bit t AR target or source,BR target or Source, 4bit sub opcode][s 4 bit, AR source, BR source, AR target][r AR target, BR target, 4 bit immediate, 4-bit sub-opcode][imm8 8 bit immediate]
         // RI16 is [4 bit major opcode][t 4 bit][imm16 16 bit immediate]
 
-        uint32_t address = 0x0; // size_t instead of uint32_t because during part of the operation can be negative we do not want it to end up negative though need to take a closer look at this TODO
-        uint32_t value = 0x0;   // should not end up changing at if it is not changed which should not be the case unless an unimplemented instruction is encountered.
-
-        // for each instruction they need to calculate the address and the value to be assigned to the register the data each time is written to register t
-        // t is in the same place for all so it can be extracted first
-        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F; // this is the index of the register to assign data to regFile[t+windowOffset] = value being loaded
         // going to be if op0 is 0001 then set up RI16 style otherwise setup RRI8 style
         uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0x0F;
         if (op0 == 0x1)
         {
-            // L32R      load literal at offset from CPU->PC(32 bit load CPU->PC relative(16 bit negative word offset))   RI16
-            // major opcode 0001     no sub opcode for this one
-            // CPU->PC relative 32 bit load
-            // address formed by adding 16 bit one extended constant value shifted left by two
-            // to teh address of teh L32R plus three with the two least significant bits cleared
-            // specifies 32-bit aligned addresses from -262141 to -4 bytes from the address of teh L32R instruction
-            // 32 bits are read from the address and written to at
-            // one of few memory instrucitons that can access instruction RAM/ROM
-            printf("\n\tThe instruction is L32R\n");
-            // Now we calculate the address for the L32R instruction
+            xten_coreL32R(CPU, opcode);
+            return;
+        }
+        // the instruction is found by looking at r
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        switch (r)
+        {
+        case 0x0:
+            xten_coreL8UI(CPU, opcode);
+            break;
+        case 0x9:
+            xten_coreL16SI(CPU, opcode);
+            break;
+        case 0x1:
+            xten_coreL16UI(CPU, opcode);
+            break;
+        case 0x2:
+            xten_coreL32I(CPU, opcode);
+            break;
+        default:
+            // if we end up here something is wrong in the machine code being executed
+            XTEN_DEBUG_PRINT("\n\tThe instruction is not implemented or something went wrong! This behaviour is undefined.\n");
+            xten_helper_illegalInstruction(CPU);
+            break;
+        }
+    }
+
+    static inline void xten_coreS8I(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // s8I       store byte                  RRI8
+        // major opcode 0010     sub opcode at r 0100
+        // adds as and zero exteneded immediate 1 byte is written from
+        // the least significant 8 bits of register at to memory at the address
+        // caclulated
+        XTEN_DEBUG_PRINT("\n\tThe instruction is S8I\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
+        uint32_t value = CPU->registerFile[CPU->windowOffset + t] & 0xFF;
+        xten_storeMemory(CPU, imm8 + CPU->registerFile[CPU->windowOffset + s], value, 1);
+    }
+
+    static inline void xten_coreS16I(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // s16I      store 16 bit quantity       RRI8
+        // major opcode 0010     sub opcode at r 0101
+        // forms address adding as and 8 bit immediate zero exteneded shifted left by one
+        // 16 least significant bits from at are written to the address formed
+        // least significant bit is ignored in the calculated address without the unaligned exception option
+        XTEN_DEBUG_PRINT("\n\tThe instruction is S16I\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
+        uint32_t value = CPU->registerFile[CPU->windowOffset + t] & 0xFFFF;
+        xten_storeMemory(CPU, (imm8 << 1) + CPU->registerFile[CPU->windowOffset + s], value, 2);
+    }
+
+    static inline void xten_coreS32I(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // s32I      store 32 bit quantity       RRI8
+        // major opcode 0010     sub opcode at r 0110
+        // forms address by adding as with 8 bit zero exteneded constant shifted left by two
+        // writes at to the memory address formed
+        // least significant 2 bits of the address are ignored without unaligned exception option
+        // can access instruction RAM
+        XTEN_DEBUG_PRINT("\n\tThe instruction is S32I\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
+        uint32_t value = CPU->registerFile[CPU->windowOffset + t] & 0xFFFFFFFF;
+        xten_storeMemory(CPU, (imm8 << 2) + CPU->registerFile[CPU->windowOffset + s], value, 4);
+    }
+
+    static inline void xten_coreStoreInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // RRI8 is [4 bit major opcode][4 bit t AR target or source,BR target or Source, 4bit sub opcode][s 4 bit, AR source, BR source, AR target][r AR target, BR target, 4 bit immediate, 4-bit sub-opcode][imm8 8 bit immediate]
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+
+        switch (r)
+        {
+        case 0x4:
+            xten_coreS8I(CPU, opcode);
+            break;
+        case 0x5:
+            xten_coreS16I(CPU, opcode);
+            break;
+        case 0x6:
+            xten_coreS32I(CPU, opcode);
+            break;
+        default:
+            XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreStoreInstructions without a valid opcode this error could have come from the code being run\n");
+            xten_helper_illegalInstruction(CPU);
+            break;
+        }
+    }
+
+    static inline void xten_coreMemoryOrderingInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // RRR is [op0][t][s][r][op1][op2]
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+
+        switch (t)
+        {
+        case 0xC:
+            // core memory ordering instructions are
+            // MEMW      wait for any possible memory ordering requirement       RRR
+            // major opcode 0000     subopcodes specified by op1 0000 op2 0000 rst in that order 0010 0000 1100
+            // in this implementation is a no-op used to seperate load and store calls needing more time
+            XTEN_DEBUG_PRINT("\n\tThe instruction is MEMW\n");
+        case 0xD:
+            // EXTW      wait for any possible external ordering requiremetn     RRR
+            // no paramiters whole thing is opcode 0000 0000 0010 0000 1101 0000
+            // ensures changes from all previous instructions before will perform
+            // any load, store, acquire, release, prefetch, or cash instructions
+            // and everything that will has affected output pins
+            XTEN_DEBUG_PRINT("\n\tThe instruction is EXTW\n");
+        default:
+            XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            xten_helper_illegalInstruction(CPU);
+            break;
+        }
+    }
+
+    static inline void xten_coreCALL0(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // CALL0     Call subroutine at CPU->PC plus offset place return address in A0                CALL
+        // subroutines without using register windows. The return address is palced in
+        // a0 and the processor then branches to the target address
+        // the return address is the address of the CALL0 instruction plus three
+        // target instruction address must be 32 bit aligned allowing CALL0 to have a larger effective range
+        // least sig two bits set to zero plus the sign-extened 18-bit offset shifted by two, plus four
+        XTEN_DEBUG_PRINT("\n\tThe instruction is CALL0\n");
+        // place return address into a0
+        CPU->registerFile[CPU->windowOffset] = CPU->PC + 3; // plus three to make sure it advances to next instruction on return
+
+        // find target instruction address
+        uint32_t address = CPU->PC & 0xFFFFFFFC;
+        uint32_t offset = (opcode >> (CPU->msbFirstOption ? 0 : 6)) & 0x3FFFF;
+        if (offset & (1 << 17))
+        {
+            offset |= 0xFFFC0000;
+        }
+        offset = offset << 2;
+        // noticed here that the program counter is set up in my implementation to point to the currently executing instruction this is an incorrect implementation
+        // but not a lot of time to fix it if and when it is fixed the offset will need to have 3 added to it to point to the next instruction
+        CPU->PC = address + offset - 3; // CPU->PC will increment by 3 at the end of the instruction
+        if (xten_helper_callNative(CPU, address + offset))
+        {
+            CPU->PC = CPU->registerFile[CPU->windowOffset] - 3; // host code ran the function so return straight away
+        }
+        CPU->addressLines = CPU->PC;
+    }
+
+    static inline void xten_coreJ(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // J         jump to CPU->PC plus offset                                                 CALL
+        // Unconditional Jump 18 bit offset followed by opcode 00 0110
+        // Performs an unconditional branch to the target address signed 18-bit CPU->PC-relative offset is used to specify the target address
+        // address of the J instruction plus the sign-extended 18-bit offset range is -131068 to 131075
+        // nextPC = CPU->PC + (offset 17 14 || offset) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is J\n");
+        uint32_t offset = (opcode >> (CPU->msbFirstOption ? 0 : 6)) & 0x3FFFF;
+        if (offset & (1 << 17))
+        {
+            offset |= 0xFFFC0000;
+        }
+        // Plus 4 issue continued look at CALL0 instruction for details
+        CPU->PC = CPU->PC + offset - 3; // CPU->PC will increment by 3 at the end of the instruction
+        CPU->addressLines = CPU->PC;
+    }
+
+    static inline void xten_coreJX(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // this is the JX instruction
+        // JX        jump to register-specified location  CALLX
+        // unconditional jump based on register specified by as
+        // perfoms an unconditional jump to the address in register as
+        XTEN_DEBUG_PRINT("\n\tThe instruction is JX\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0xF;
+        CPU->PC = CPU->registerFile[CPU->windowOffset + s] - 3; // CPU->PC will increment by 3 at the end of the instruction
+        CPU->addressLines = CPU->PC;
+    }
+
+    static inline void xten_coreCALLX0(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // CALLX0    Call subroutine register specified location, place return address in A0     CALLX
+        // calls subroutines without using register windows the return address is placed in a0 and teh processor
+        // then branches to the target address,
+        XTEN_DEBUG_PRINT("\n\tThe instruction is CALLX0\n");
+        CPU->registerFile[CPU->windowOffset] = CPU->PC + 3; // plus three to make sure it advances to next instruction on return
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0xF;
+        CPU->PC = CPU->registerFile[CPU->windowOffset + s] - 3; // CPU->PC will increment by 3 at the end of the instruction
+        if (xten_helper_callNative(CPU, CPU->registerFile[CPU->windowOffset + s]))
+        {
+            CPU->PC = CPU->registerFile[CPU->windowOffset] - 3; // host code ran the function so return straight away
+        }
+        CPU->addressLines = CPU->PC;
+    }
 
-            uint16_t constValue = (opcode >> (CPU->msbFirstOption ? 0 : 8)) & 0xFFFF;
-            int32_t oneExtendedConst = (int16_t)constValue;
-            uint32_t address = (CPU->PC + 3 + (oneExtendedConst << 2)) & 0xFFFFFFFC;
+    static inline void xten_coreRET(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // RET       subroutine return through A0    CALLX
+        // 0000 0000 0000 0000 10 00 0000
+        // This returns from routine called by either CALL0 or CALLX0 equivalent to the instruction JX A0
+        // serparate instruction because some implementations may realize performace advantages from it being seperate
+        XTEN_DEBUG_PRINT("\n\tThe instruction is RET\n");
+        (void)opcode;
+        CPU->PC = CPU->registerFile[CPU->windowOffset] - 3; // CPU->PC will increment by 3 at the end of the instruction
+        CPU->addressLines = CPU->PC;
+    }
+
+    static inline void xten_coreJumpCallInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode) // TODO testing for jump and call instructions
+    {
+        // get parts
+        uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0xF;
+        uint32_t n = (opcode >> (CPU->msbFirstOption ? 18 : 2)) & 0x3;
+        uint32_t m = (opcode >> (CPU->msbFirstOption ? 16 : 6)) & 0x3;
 
-            // we recieve the value for the instruction to load and manipulate as nessecerry
-            value = CPU->readMemory(CPU, address, CPU->callbackContext);
+        // sort through the instructions
+        if (op0 == 0x5)
+        {
+            xten_coreCALL0(CPU, opcode);
+        }
+        else if (op0 == 0x6)
+        {
+            xten_coreJ(CPU, opcode);
         }
         else
         {
-            // these instructions require s which defines what register is being added to create virtual address
-            uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
-            // instructions also require the 8 bit immidiate that is added to s to form the virtual address
-            uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // this is the zero extended version
-            // the instruction is found by looking at r
-            uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
-            switch (r)
+            // further testing nessesary
+            if (n == 0x2)
             {
-            case 0x0:
-                // core load instructions are
-                // L8UI      load zero-extended byte(8 bit unsigned load(8 bit offset))                             RRI8
-                // major opcode 0010     4-bit sub opcode in r 0000
-                // adds contents of register represented by s to 8 bit immediate
-                // data at memory address represented by this addition is then stored
-                // in register represented by t zero extended
-                printf("\n\tThe instruction is L8UI\n");
-                address = CPU->registerFile[CPU->windowOffset + s] + imm8;
-                value = CPU->readMemory(CPU, address, CPU->callbackContext) >> 24; // only 8 bits are read zero extended
-                break;
-            case 0x9:
-                // L16SI     load signed extended 16 bit quantity(16 bit signed load(8 bit shifted offset))         RRI8
-                // major opcode 0010     4-bit sub opcode stored in r 1001
-                // 8 bit constant added to register represented by s shifted left by 1
-                // 16 bits two bytes read from register at the memory location this makes the value
-                // sign extended and then stored in register represented by t
-                // without unaligned exception option least significant address bit is ignored
-                // essentially subtract one from odd addresses before accessing
-                printf("\n\tThe instruction is L16SI\n");
-                address = CPU->registerFile[CPU->windowOffset + s] + (imm8 << 1);
-                value = CPU->readMemory(CPU, address, CPU->callbackContext) >> 16; // only 16 bits are read sign extended
-                value = xten_helper_signExtend32Bits(value, 16);
-                break;
-            case 0x1:
-                // L16UI     load zero extended 16 bit quantity(16 bit unsigned load(8 bit shifted offset))         RRI8
-                // major opcode 0010     4-bit sub opcode stored in r 0001
-                // adds as and 8 bit immediate shifted left by 1
-                // reads in data like in L16SI except the data is zero extended instead of sign extened
-                printf("\n\tThe instruction is L16UI\n");
-                address = CPU->registerFile[CPU->windowOffset + s] + (imm8 << 1);
-                value = CPU->readMemory(CPU, address, CPU->callbackContext) >> 16; // only 16 bits are read sign extended
-                break;
-            case 0x2:
-                // L32I      load 32 bit quantity(32 bit load(8 bit shifted offset))                                RRI8
-                // major opcode 0010     4-bit sub opcode stored in r 0010
-                // adds register as and 8 bit zero extended constant shifted left by 2
-                // reads address this represents 4 bytes of it written to register at
-                // this instruction ignores least significant two bits of the address calculated
-                // without unaligned exception option
-                printf("\n\tThe instruction is L32I\n");
-                address = CPU->registerFile[CPU->windowOffset + s] + (imm8 << 2);
-                value = CPU->readMemory(CPU, address, CPU->callbackContext);
-                break;
-            default:
-                // if we end up here something is wrong in the machine code being executed
-                printf("\n\tThe instruction is not implemented or something went wrong! This behaviour is undefined.\n");
-                break;
+                xten_coreJX(CPU, opcode);
+            }
+            else
+            {
+                if (m == 0x3)
+                {
+                    xten_coreCALLX0(CPU, opcode);
+                }
+                else if (m == 0x2)
+                {
+                    xten_coreRET(CPU, opcode);
+                }
             }
         }
-        printf("\naddress is %8X and value to be assigned from that address is %8X\n", address, value);
-        CPU->registerFile[CPU->windowOffset + t] = value;
     }
 
-    static inline void xten_coreStoreInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    /**
+     * @brief Finishes an RRI8 branch moving to the target when it is taken and counting it for the stats
+     *
+     * @param CPU A pointer to the current CPU context.
+     * @param opcode The branch opcode the 8 bit offset is taken from.
+     * @param willBranch8 Whether the branch condition held.
+     */
+    static inline void xten_helper_branch8(Xtensa_lx_CPU *CPU, uint32_t opcode, bool willBranch8)
+    {
+        if (willBranch8)
+        {
+            // branch to target
+            int8_t offset = (int8_t)((opcode >> (CPU->msbFirstOption ? 0 : 6)) & 0xFF);
+            uint32_t target = CPU->PC + ((int32_t)offset << 2);
+            CPU->PC = target - 3; // the minus three is required because the CPU->PC will increment at the end of this instruction
+            CPU->addressLines = CPU->PC;
+        }
+#ifdef XTEN_ENABLE_STATS
+        if (willBranch8)
+        {
+            CPU->stats.branchesTaken++;
+        }
+        else
+        {
+            CPU->stats.branchesNotTaken++;
+        }
+#endif
+    }
+
+    static inline void xten_coreBNONE(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BNONE     branch if all bits spcified by a mask in a register are clear in another register       RRI8
+        // branches if all of the bits specified by the mask in at are clear in as(if non of them are set) test is performed
+        // by taking bitwise logical and of as with at and testing if result is zero
+        // target is BNONE address plus the sign-extended imm8 plus 4 if any of the masked bits are set execution continues
+        // with the next sequential instruction
+        // if (AR[s] and AR[t]) = 0^32 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BNONE\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        xten_helper_branch8(CPU, opcode, (CPU->registerFile[CPU->windowOffset + s] & CPU->registerFile[CPU->windowOffset + t]) == 0x0);
+    }
+
+    static inline void xten_coreBEQ(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BEQ       branch if a register equals another register                                            RRI8
+        // branches if address registers as and at are equal
+        // target instruction is address of the BEQ instruction plus the sign-extended 8-bit imm8 field of the instruction
+        // plus 4. if registers are not equal execution continues with the next sequential instruction
+        // if AR[s] = AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BEQ\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        xten_helper_branch8(CPU, opcode, CPU->registerFile[CPU->windowOffset + s] == CPU->registerFile[CPU->windowOffset + t]);
+    }
+
+    static inline void xten_coreBLT(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BLT       branch if one register is less than a register                                          RRI8
+        // branches if address register as is two's complement less than address register at
+        // target is address of BLT plus sign-extended imm8 plus 4 if as greater than or equal to at execution continues
+        // with next sequential instruction
+        // if AR[s] < AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BLT\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, as < at);
+    }
+
+    static inline void xten_coreBLTU(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BLTU      branch if one register is less than a register as unsigned                              RRI8
+        // branches if as is unsigned less thna at
+        // target is BLTU addres plus sign-extended imm8 plus four if as is greater than or equal to at execution continues
+        // with the next sequential instruction
+        // if (0||AR[s]) < (0||AR[t]) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BLTU\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, as < at);
+    }
+
+    static inline void xten_coreBALL(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BALL      branch if all bits specified by a mask in one register are set in another register      RRI8
+        // branches if all bits specified by the mask in address register at are set in address register as
+        // test performed by taking bitwise logical and of at and the complement of as and seeing if result is zero
+        // target address is address of the BALL instruction plus the sign-extended 8-bit imm8 plus four if any
+        // masked bits are clear execution continus with next sequential instruction
+        // if((not AR[s]) and AR[t]) = 0^32 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BALL\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, (at & ~as) == 0);
+    }
+
+    static inline void xten_coreBBC(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BBC       branch if the bit specified by antoher register is clear                                RRI8
+        // branches if teh bit specified by the low five bits of address register at is clear in addreses register as
+        // for little-endian bit 0 is least significant bit and bi endian bit 0 is most significant bit
+        // target instruction address of the branch is given bay address of BBC instruction plus the sign-extended 8-bit imm8
+        // field plus four if specified bit is set execution continues with the next sequential instruction
+        // b = AR[t]4..0 xor msbFirst^5
+        // if AR[s] b = 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BBC\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        uint32_t bit = at & 0x1F;
+        if (CPU->msbFirstOption)
+        {
+            // For big endian, bit 0 is the most significant bit.
+            bit = 31 - bit;
+        }
+        xten_helper_branch8(CPU, opcode, (as & (1 << bit)) == 0);
+    }
+
+    static inline void xten_coreBBCI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BBCI      branch if the bit specified by an immediate is clear                                    RRI8
+        // branches if specified by constant encoded in bbi field is clear in address register as
+        // bbi field is split with bits 3..0 in bits 7..4 of the instruction word, and bit 4 in bit 12 of the instruction
+        // word. target address given by address of the BBCI instruction plus sign-extended 8-bit imm8 field of the instruction
+        // plus 4. If the specified bit is set, execution continues with the next sequential instruction.
+        // b = bbi xor msbFirst^5
+        // if AR[s] b = 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BBCI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t bbi4_0 = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F; // bbi bits 3..0
+        uint32_t bbi5 = (opcode >> (CPU->msbFirstOption ? 12 : 12)) & 0x01;  // bbi bit 4
+        uint32_t bbi = (bbi5 << 4) | bbi4_0;
+        if (CPU->msbFirstOption)
+        {
+            // For big endian, bit 0 is the most significant bit.
+            bbi = 31 - bbi;
+        }
+        xten_helper_branch8(CPU, opcode, (as & (1 << bbi)) == 0);
+    }
+
+    static inline void xten_coreBANY(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BANY      branch if any bits specified by a mask in one register are set in another register      RRI8
+        // branches if any of the bits specified by mask in address register at are set in address register as
+        // tested by bitwise logical and of as and at and testing if result is non-zero
+        // target address given by address of BANY plus the sign-extended 8-bit imm8 field of the instruction plus
+        // four if all masked bits are clear execution continues with the next sequential instruction
+        // if(AR[s] and AR[t]) != 0^32 then nextPC = CPU->PC+(imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BANY\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, (as & at) != 0);
+    }
+
+    static inline void xten_coreBNE(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BNE       branch if a register does not equal a register                                          RRI8
+        // branches if as and at are not equal
+        // target address is BNE address plus sign-extended imm8 plus 4 if the registers are equal execution continues with the next
+        // sequential instruction
+        // if AR[s] != AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BNE\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, as != at);
+    }
+
+    static inline void xten_coreBGE(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BGE       branch if a register is greater than or equal to a register                             RRI8
+        // branches if address as is two's complement greater then or equal ot address at register at
+        // target is BGE instruction address pluse sign-extended imm8 plus four.
+        // if as is less than at execution continues with next sequential instruction
+        // if AR[s] >= AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BGE\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, as >= at);
+    }
+
+    static inline void xten_coreBGEU(Xtensa_lx_CPU *CPU, uint32_t opcode)
     {
-        // RRI8 is [4 bit major opcode][4 bit t AR target or source,BR target or Source, 4bit sub opcode][s 4 bit, AR source, BR source, AR target][r AR target, BR target, 4 bit immediate, 4-bit sub-opcode][imm8 8 bit immediate]
-        // firstly we extract the parts of the opcode
+        // BGEU      branch if one register is greater than or equal to a register as unsigned               RRI8
+        //  branches if as is unsigned greater then or equal to address register at
+        // target address is BGEU address plus sign-extended imm8 plus 4 if as is less than at execution continues with next
+        // sequential instruction.
+        // if (0||AR[s]) >= (0||AR[t]) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BGEU\n");
         uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
         uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
-        uint32_t imm8 = (opcode >> (CPU->msbFirstOption ? 0 : 16)) & 0xFF; // zero extended
-        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
-        uint32_t value = 0;
-
-        switch (r)
-        {
-        case 0x4:
-            // core store instructions are
-            // s8I       store byte                  RRI8
-            // major opcode 0010     sub opcode at r 0100
-            // adds as and zero exteneded immediate 1 byte is written from
-            // the least significant 8 bits of register at to memory at the address
-            // caclulated
-            printf("\n\tThe instruction is S8I\n");
-            value = CPU->registerFile[CPU->windowOffset + t] & 0xFF;
-            CPU->writeMemory(CPU, imm8 + CPU->registerFile[CPU->windowOffset + s], value, 1, CPU->callbackContext);
-            break;
-        case 0x5:
-            // s16I      store 16 bit quantity       RRI8
-            // major opcode 0010     sub opcode at r 0101
-            // forms address adding as and 8 bit immediate zero exteneded shifted left by one
-            // 16 least significant bits from at are written to the address formed
-            // least significant bit is ignored in the calculated address without the unaligned exception option
-            printf("\n\tThe instruction is S16I\n");
-            value = CPU->registerFile[CPU->windowOffset + t] & 0xFFFF;
-            CPU->writeMemory(CPU, (imm8 << 1) + CPU->registerFile[CPU->windowOffset + s], value, 2, CPU->callbackContext);
-            break;
-        case 0x6:
-            // s32I      store 32 bit quantity       RRI8
-            // major opcode 0010     sub opcode at r 0110
-            // forms address by adding as with 8 bit zero exteneded constant shifted left by two
-            // writes at to the memory address formed
-            // least significant 2 bits of the address are ignored without unaligned exception option
-            // can access instruction RAM
-            printf("\n\tThe instruction is S32I\n");
-            value = CPU->registerFile[CPU->windowOffset + t] & 0xFFFFFFFF;
-            CPU->writeMemory(CPU, (imm8 << 2) + CPU->registerFile[CPU->windowOffset + s], value, 4, CPU->callbackContext);
-            break;
-        default:
-            printf("\nSomething went wrong proceeded to xten_coreStoreInstructions without a valid opcode this error could have come from the code being run\n");
-            break;
-        }
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, as >= at);
     }
 
-    static inline void xten_coreMemoryOrderingInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    static inline void xten_coreBNALL(Xtensa_lx_CPU *CPU, uint32_t opcode)
     {
-        // RRR is [op0][t][s][r][op1][op2]
+        // BNALL     branch if some bits specified by a mask in a register are clear in another register     RRI8
+        // branches if any of the bits specified by the mask in at are clear in as(if they are not all set). test
+        // is performed by taking the bitwise logical and of at with the complement of as and testing if result is non-zero
+        // target is BNALL address plus sign-extended 8-bit imm8 plus 4 if all masked bits are set execution continues
+        // with the next sequential instruction
+        // if((not AR[s]) and AR[t]) != 0 ^32 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BNALL\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
         uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
-
-        switch (t)
-        {
-        case 0xC:
-            // core memory ordering instructions are
-            // MEMW      wait for any possible memory ordering requirement       RRR
-            // major opcode 0000     subopcodes specified by op1 0000 op2 0000 rst in that order 0010 0000 1100
-            // in this implementation is a no-op used to seperate load and store calls needing more time
-            printf("\n\tThe instruction is MEMW\n");
-        case 0xD:
-            // EXTW      wait for any possible external ordering requiremetn     RRR
-            // no paramiters whole thing is opcode 0000 0000 0010 0000 1101 0000
-            // ensures changes from all previous instructions before will perform
-            // any load, store, acquire, release, prefetch, or cash instructions
-            // and everything that will has affected output pins
-            printf("\n\tThe instruction is EXTW\n");
-        default:
-            printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
-            break;
-        }
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        xten_helper_branch8(CPU, opcode, (at & ~as) != 0);
     }
 
-    static inline void xten_coreJumpCallInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode) // TODO testing for jump and call instructions
+    static inline void xten_coreBBS(Xtensa_lx_CPU *CPU, uint32_t opcode)
     {
-        // get parts
-        uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0xF;
-        uint32_t n = (opcode >> (CPU->msbFirstOption ? 18 : 2)) & 0x3;
-        uint32_t m = (opcode >> (CPU->msbFirstOption ? 16 : 6)) & 0x3;
-        uint32_t offset = 0;
-
-        // sort through the instructions
-        if (op0 == 0x5)
-        {
-            // CALL0     Call subroutine at CPU->PC plus offset place return address in A0                CALL
-            // subroutines without using register windows. The return address is palced in
-            // a0 and the processor then branches to the target address
-            // the return address is the address of the CALL0 instruction plus three
-            // target instruction address must be 32 bit aligned allowing CALL0 to have a larger effective range
-            // least sig two bits set to zero plus the sign-extened 18-bit offset shifted by two, plus four
-            printf("\n\tThe instruction is CALL0\n");
-
-            // place return address into a0
-            CPU->registerFile[CPU->windowOffset] = CPU->PC + 3; // plus three to make sure it advances to next instruction on return
+        // BBS       branch if the bit specified by another register is set                                  RRI8
+        // brances if the bit specified by the low five bits of address register at is set in address reigister as
+        // target address is the address of the BBS instruction plus the sign-extended 8-bit imm8 field of the instruction
+        // plus four. if the specified bit is clear, execution continues with the next sequential instruction
+        // b = AR[t] 4..0 xor msbFirst^5
+        // if AR[s]b != 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BBS\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t at = CPU->registerFile[CPU->windowOffset + t];
+        uint32_t bit = at & 0x1F;
+        xten_helper_branch8(CPU, opcode, (as & (1 << bit)) != 0);
+    }
 
-            // find target instruction address
-            uint32_t address = CPU->PC & 0xFFFFFFFC;
-            offset = (opcode >> (CPU->msbFirstOption ? 0 : 6)) & 0x3FFFF;
-            if (offset & (1 << 17))
-            {
-                offset |= 0xFFFC0000;
-            }
-            offset = offset << 2;
-            // noticed here that the program counter is set up in my implementation to point to the currently executing instruction this is an incorrect implementation
-            // but not a lot of time to fix it if and when it is fixed the offset will need to have 3 added to it to point to the next instruction
-            CPU->PC = address + offset - 3; // CPU->PC will increment by 3 at the end of the instruction
-            CPU->addressLines = CPU->PC;
-        }
-        else if (op0 == 0x6)
-        {
-            // J         jump to CPU->PC plus offset                                                 CALL
-            // Unconditional Jump 18 bit offset followed by opcode 00 0110
-            // Performs an unconditional branch to the target address signed 18-bit CPU->PC-relative offset is used to specify the target address
-            // address of the J instruction plus the sign-extended 18-bit offset range is -131068 to 131075
-            // nextPC = CPU->PC + (offset 17 14 || offset) + 4
-            printf("\n\tThe instruction is J\n");
-            offset = (opcode >> (CPU->msbFirstOption ? 0 : 6)) & 0x3FFFF;
-            if (offset & (1 << 17))
-            {
-                offset |= 0xFFFC0000;
-            }
-            // Plus 4 issue continued look at CALL0 instruction for details
-            CPU->PC = CPU->PC + offset - 3; // CPU->PC will increment by 3 at the end of the instruction
-            CPU->addressLines = CPU->PC;
-        }
-        else
+    static inline void xten_coreBBSI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // BBSI      branch if the bit specified by an immediate is set                                      RRI8
+        // branches if the bit specified by the constant encoded in bbi field is set in address register as
+        // bbi field is split with bits 3..0 in bits 7..4 of the instruction word and bit 4 in bit 12 of the instruction word
+        // the target instruction address of the branch is iven by teh address of the BBsinstruction plus the sign
+        // extended 8-bit imm8 field of the instruction plus four. if the specified bit is clear execution continues with the
+        // next sequential instruction.
+        // b = bbi xor msbFirst^5
+        // if AR[s]b != 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
+        XTEN_DEBUG_PRINT("\n\tThe instruction is BBSI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t as = CPU->registerFile[CPU->windowOffset + s];
+        uint32_t bbi4_0 = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F; // bbi bits 3..0
+        uint32_t bbi5 = (opcode >> (CPU->msbFirstOption ? 12 : 12)) & 0x01;  // bbi bit 4
+        uint32_t bbi = (bbi5 << 4) | bbi4_0;
+        if (CPU->msbFirstOption)
         {
-            // further testing nessesary
-            if (n == 0x2)
-            {
-                // this is the JX instruction
-                // JX        jump to register-specified location  CALLX
-                // unconditional jump based on register specified by as
-                // perfoms an unconditional jump to the address in register as
-                printf("\n\tThe instruction is JX\n");
-                uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0xF;
-                CPU->PC = CPU->registerFile[CPU->windowOffset + s] - 3; // CPU->PC will increment by 3 at the end of the instruction
-                CPU->addressLines = CPU->PC;
-            }
-            else
-            {
-                if (m == 0x3)
-                {
-                    // CALLX0    Call subroutine register specified location, place return address in A0     CALLX
-                    // calls subroutines without using register windows the return address is placed in a0 and teh processor
-                    // then branches to the target address,
-                    printf("\n\tThe instruction is CALLX0\n");
-                    CPU->registerFile[CPU->windowOffset] = CPU->PC + 3; // plus three to make sure it advances to next instruction on return
-                    uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0xF;
-                    CPU->PC = CPU->registerFile[CPU->windowOffset + s] - 3; // CPU->PC will increment by 3 at the end of the instruction
-                    CPU->addressLines = CPU->PC;
-                }
-                else if (m == 0x2)
-                {
-                    // RET       subroutine return through A0    CALLX
-                    // 0000 0000 0000 0000 10 00 0000
-                    // This returns from routine called by either CALL0 or CALLX0 equivalent to the instruction JX A0
-                    // serparate instruction because some implementations may realize performace advantages from it being seperate
-                    printf("\n\tThe instruction is RET\n");
-                    CPU->PC = CPU->registerFile[CPU->windowOffset] - 3; // CPU->PC will increment by 3 at the end of the instruction
-                    CPU->addressLines = CPU->PC;
-                }
-            }
+            // For big endian, bit 0 is the most significant bit.
+            bbi = 31 - bbi;
         }
+        xten_helper_branch8(CPU, opcode, (as & (1 << bbi)) != 0);
     }
 
     static inline void xten_coreConditionalBranchInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode) // TODO create code to test a subset at least of these branch instructions
@@ -1172,265 +6264,55 @@ extern "C"
             switch (r)
             {
             case 0x0:
-                // BNONE     branch if all bits spcified by a mask in a register are clear in another register       RRI8
-                // branches if all of the bits specified by the mask in at are clear in as(if non of them are set) test is performed
-                // by taking bitwise logical and of as with at and testing if result is zero
-                // target is BNONE address plus the sign-extended imm8 plus 4 if any of the masked bits are set execution continues
-                // with the next sequential instruction
-                // if (AR[s] and AR[t]) = 0^32 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BNONE\n");
-                if ((CPU->registerFile[CPU->windowOffset + s] & CPU->registerFile[CPU->windowOffset + t]) == 0x0)
-                {
-                    willBranch8 = true;
-                }
+                xten_coreBNONE(CPU, opcode);
                 break;
             case 0x1:
-                // BEQ       branch if a register equals another register                                            RRI8
-                // branches if address registers as and at are equal
-                // target instruction is address of the BEQ instruction plus the sign-extended 8-bit imm8 field of the instruction
-                // plus 4. if registers are not equal execution continues with the next sequential instruction
-                // if AR[s] = AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BEQ\n");
-                if (CPU->registerFile[CPU->windowOffset + s] == CPU->registerFile[CPU->windowOffset + t])
-                {
-                    willBranch8 = true;
-                }
+                xten_coreBEQ(CPU, opcode);
                 break;
             case 0x2:
-            {
-                // BLT       branch if one register is less than a register                                          RRI8
-                // branches if address register as is two's complement less than address register at
-                // target is address of BLT plus sign-extended imm8 plus 4 if as greater than or equal to at execution continues
-                // with next sequential instruction
-                // if AR[s] < AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BLT\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-
-                if (as < at)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBLT(CPU, opcode);
+                break;
             case 0x3:
-            {
-                // BLTU      branch if one register is less than a register as unsigned                              RRI8
-                // branches if as is unsigned less thna at
-                // target is BLTU addres plus sign-extended imm8 plus four if as is greater than or equal to at execution continues
-                // with the next sequential instruction
-                // if (0||AR[s]) < (0||AR[t]) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BLTU\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-
-                if (as < at)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBLTU(CPU, opcode);
+                break;
             case 0x4:
-            {
-                // BALL      branch if all bits specified by a mask in one register are set in another register      RRI8
-                // branches if all bits specified by the mask in address register at are set in address register as
-                // test performed by taking bitwise logical and of at and the complement of as and seeing if result is zero
-                // target address is address of the BALL instruction plus the sign-extended 8-bit imm8 plus four if any
-                // masked bits are clear execution continus with next sequential instruction
-                // if((not AR[s]) and AR[t]) = 0^32 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BALL\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-
-                if ((at & ~as) == 0)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBALL(CPU, opcode);
+                break;
             case 0x5:
-            {
-                // BBC       branch if the bit specified by antoher register is clear                                RRI8
-                // branches if teh bit specified by the low five bits of address register at is clear in addreses register as
-                // for little-endian bit 0 is least significant bit and bi endian bit 0 is most significant bit
-                // target instruction address of the branch is given bay address of BBC instruction plus the sign-extended 8-bit imm8
-                // field plus four if specified bit is set execution continues with the next sequential instruction
-                // b = AR[t]4..0 xor msbFirst^5
-                // if AR[s] b = 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BBC\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-                uint32_t bit = at & 0x1F;
-
-                if (CPU->msbFirstOption)
-                {
-                    // For big endian, bit 0 is the most significant bit.
-                    bit = 31 - bit;
-                }
-                if ((as & (1 << bit)) == 0)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBBC(CPU, opcode);
+                break;
             case 0x6:
                 // break omitted because implementation same as the instruction below
             case 0x7:
-            {
-                // BBCI      branch if the bit specified by an immediate is clear                                    RRI8
-                // branches if specified by constant encoded in bbi field is clear in address register as
-                // bbi field is split with bits 3..0 in bits 7..4 of the instruction word, and bit 4 in bit 12 of the instruction
-                // word. target address given by address of the BBCI instruction plus sign-extended 8-bit imm8 field of the instruction
-                // plus 4. If the specified bit is set, execution continues with the next sequential instruction.
-                // b = bbi xor msbFirst^5
-                // if AR[s] b = 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BBCI\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t bbi4_0 = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F; // bbi bits 3..0
-                uint32_t bbi5 = (opcode >> (CPU->msbFirstOption ? 12 : 12)) & 0x01;  // bbi bit 4
-                uint32_t bbi = (bbi5 << 4) | bbi4_0;                                 // Combine to get the full bbi value
-                if (CPU->msbFirstOption)
-                {
-                    // For big endian, bit 0 is the most significant bit.
-                    bbi = 31 - bbi;
-                }
-                if ((as & (1 << bbi)) == 0)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBBCI(CPU, opcode);
+                break;
             case 0x8:
-            {
-                // BANY      branch if any bits specified by a mask in one register are set in another register      RRI8
-                // branches if any of the bits specified by mask in address register at are set in address register as
-                // tested by bitwise logical and of as and at and testing if result is non-zero
-                // target address given by address of BANY plus the sign-extended 8-bit imm8 field of the instruction plus
-                // four if all masked bits are clear execution continues with the next sequential instruction
-                // if(AR[s] and AR[t]) != 0^32 then nextPC = CPU->PC+(imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BANY\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-                if ((as & at) != 0)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBANY(CPU, opcode);
+                break;
             case 0x9:
-            {
-                // BNE       branch if a register does not equal a register                                          RRI8
-                // branches if as and at are not equal
-                // target address is BNE address plus sign-extended imm8 plus 4 if the registers are equal execution continues with the next
-                // sequential instruction
-                // if AR[s] != AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BNE\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-                if (as != at)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBNE(CPU, opcode);
+                break;
             case 0xA:
-            {
-                // BGE       branch if a register is greater than or equal to a register                             RRI8
-                // branches if address as is two's complement greater then or equal ot address at register at
-                // target is BGE instruction address pluse sign-extended imm8 plus four.
-                // if as is less than at execution continues with next sequential instruction
-                // if AR[s] >= AR[t] then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BGE\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                if (as >= at)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBGE(CPU, opcode);
+                break;
             case 0xB:
-            {
-                // BGEU      branch if one register is greater than or equal to a register as unsigned               RRI8
-                //  branches if as is unsigned greater then or equal to address register at
-                // target address is BGEU address plus sign-extended imm8 plus 4 if as is less than at execution continues with next
-                // sequential instruction.
-                // if (0||AR[s]) >= (0||AR[t]) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BGEU\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-                if (as >= at)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBGEU(CPU, opcode);
+                break;
             case 0xC:
-            {
-                // BNALL     branch if some bits specified by a mask in a register are clear in another register     RRI8
-                // branches if any of the bits specified by the mask in at are clear in as(if they are not all set). test
-                // is performed by taking the bitwise logical and of at with the complement of as and testing if result is non-zero
-                // target is BNALL address plus sign-extended 8-bit imm8 plus 4 if all masked bits are set execution continues
-                // with the next sequential instruction
-                // if((not AR[s]) and AR[t]) != 0 ^32 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BNALL\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-                if ((at & ~as) != 0)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBNALL(CPU, opcode);
+                break;
             case 0xD:
-            {
-                // BBS       branch if the bit specified by another register is set                                  RRI8
-                // brances if the bit specified by the low five bits of address register at is set in address reigister as
-                // target address is the address of the BBS instruction plus the sign-extended 8-bit imm8 field of the instruction
-                // plus four. if the specified bit is clear, execution continues with the next sequential instruction
-                // b = AR[t] 4..0 xor msbFirst^5
-                // if AR[s]b != 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BBS\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t at = CPU->registerFile[CPU->windowOffset + t];
-                uint32_t bit = at & 0x1F;
-                if (as & (1 << bit)) // If the bit at 'bitIndex' in 'as' is set
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBBS(CPU, opcode);
+                break;
             case 0xE:
                 // break omitted because implementation same as the instruction below
             case 0xF:
-            {
-                // BBSI      branch if the bit specified by an immediate is set                                      RRI8
-                // branches if the bit specified by the constant encoded in bbi field is set in address register as
-                // bbi field is split with bits 3..0 in bits 7..4 of the instruction word and bit 4 in bit 12 of the instruction word
-                // the target instruction address of the branch is iven by teh address of the BBsinstruction plus the sign
-                // extended 8-bit imm8 field of the instruction plus four. if the specified bit is clear execution continues with the
-                // next sequential instruction.
-                // b = bbi xor msbFirst^5
-                // if AR[s]b != 0 then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BBSI\n");
-                uint32_t as = CPU->registerFile[CPU->windowOffset + s];
-                uint32_t bbi4_0 = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F; // bbi bits 3..0
-                uint32_t bbi5 = (opcode >> (CPU->msbFirstOption ? 12 : 12)) & 0x01;  // bbi bit 4
-                uint32_t bbi = (bbi5 << 4) | bbi4_0;
-                if (CPU->msbFirstOption)
-                {
-                    // For big endian, bit 0 is the most significant bit.
-                    bbi = 31 - bbi;
-                }
-                if ((as & (1 << bbi)) != 0)
-                {
-                    willBranch8 = true;
-                }
-            }
-            break;
+                xten_coreBBSI(CPU, opcode);
+                break;
             }
+            return; // the instruction took or skipped its branch and counted it itself
         }
-        else if (op0 == 0x6)
+        if (op0 == 0x6)
         {
             switch (t)
             {
@@ -1442,7 +6324,7 @@ extern "C"
                 // the sign-exteneded 12 bit imm12 field of the instruction plus 4.
                 // if register as is not zero execution conintues with the next sequential instruction
                 // if AR[s] = 0^32 then nextPC = CPU->PC + (imm12 11 20||imm12) + 4
-                printf("\n\tThe instruction is BEQZ\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BEQZ\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if (as == 0)
                 {
@@ -1458,7 +6340,7 @@ extern "C"
                 // target instruction of the branch is given by address of BEQI instruction plus the sing-extended 8-bit imm8 field plus 4.
                 // if register is not equal to the constant execution continues with the next sequential instruction.
                 // if AR[s] = B4CONST(r) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BEQI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BEQI\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if (as == xten_table317[r])
                 {
@@ -1473,7 +6355,7 @@ extern "C"
                 // target is BNEZ instruction plus sign-extended imm12 plus 4 if register as equals zero execution continues
                 // with the next sequential instruction
                 // if AR[s] != 0 ^32 then nextPC = CPU->PC + (imm12 11 20||imm12) + 4
-                printf("\n\tThe instruction is BNEZ\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BNEZ\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if (as != 0)
                 {
@@ -1487,7 +6369,7 @@ extern "C"
                 // branches if as and constant encoded in r field(see table 3-17 on page 41) are not equal. target address is
                 // BNEI address plus sign-extended imm8 plus 4. if register is equal to the constant, execution continues with the next sequential instruciton
                 // if AR[s] != B4CONST(r) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BNEI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BNEI\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if (as != xten_table317[r])
                 {
@@ -1502,7 +6384,7 @@ extern "C"
                 // target is BLTZ address plus sign-extended imm12 plus 4 if as is greater than or equal to zero execution
                 // continues with the next sequential instruction.
                 // if AR[s]31 != 0 then nextPC = CPU->PC + (imm12 11 20||imm12) + 4
-                printf("\n\tThe instruction is BLTZ\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BLTZ\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if ((as & 0x80000000) != 0)
                 {
@@ -1517,7 +6399,7 @@ extern "C"
                 // target address is BLTI address plus sign-extended imm8 plus 4
                 // if as is greater than or equal to the constant execution continues with the next sequential instruction
                 // if AR[s] < B4CONST(r) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BLTI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BLTI\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if ((int32_t)as < (int32_t)xten_table317[r])
                 {
@@ -1532,7 +6414,7 @@ extern "C"
                 // target is BLTUI address pluse sign-extended imm8 plus 4 if as is greater than or equal to the constant
                 // execution continues with the next sequential instruction
                 // if(0||AR[s]) < (0||B4CONSTU(r)) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BLTUI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BLTUI\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if (as < xten_table317[r])
                 {
@@ -1547,7 +6429,7 @@ extern "C"
                 // target address is BGEZ address plus sign-extended imm12 plus 4 if register as is less than zero execution continues
                 // with next sequential instruction
                 // if AR[s]31 = 0 then nextPC = CPU->PC + (imm12 11 20||imm12) + 4
-                printf("\n\tThe instruction is BGEZ\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BGEZ\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if (as >= 0)
                 {
@@ -1561,7 +6443,7 @@ extern "C"
                 // target is address of BGEI instruction plus the sign-extended imm8 plus four if address register as is less
                 // than the constant execution continues with the next sequential instruction
                 // if AR[s] >= B4CONST(r) then nextPC = CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BGEI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BGEI\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if ((int32_t)as >= (int32_t)xten_table317[r])
                 {
@@ -1576,7 +6458,7 @@ extern "C"
                 // target address is address of BGEUI plus sign-extended imm8 plus 4 if as less then constant execution continues
                 // with next sequential instruction
                 // if(-||AR[s]) >= (0||B4CONSTU(r)) then nextPC - CPU->PC + (imm8 7 24||imm8) + 4
-                printf("\n\tThe instruction is BGEUI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is BGEUI\n");
                 uint32_t as = CPU->registerFile[CPU->windowOffset + s];
                 if (as >= xten_table317[r])
                 {
@@ -1585,117 +6467,337 @@ extern "C"
             }
             break;
             default:
-                printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
         }
         else
         {
-            printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            xten_helper_illegalInstruction(CPU);
+        }
+
+        if (willBranch8)
+        {
+            // branch to target
+            offset = (int8_t)imm8;
+            target = CPU->PC + ((int32_t)offset << 2);
+            CPU->PC = target - 3; // the minus three is required because the CPU->PC will increment at the end of this instruction
+            CPU->addressLines = CPU->PC;
+        }
+        else if (willBranch12)
+        {
+            // branch to target
+            int32_t offset = imm12;
+            if (offset & 0x800)
+            {                         // If the sign bit is set
+                offset |= 0xFFFFF000; // Sign extend
+            }
+            CPU->PC = CPU->PC + offset - 3; // the minus three is required because the CPU->PC will increment at the end of this instruction
+            CPU->addressLines = CPU->PC;
+        }
+#ifdef XTEN_ENABLE_STATS
+        if (willBranch8 || willBranch12)
+        {
+            CPU->stats.branchesTaken++;
+        }
+        else
+        {
+            CPU->stats.branchesNotTaken++;
+        }
+#endif
+    }
+
+    static inline void xten_coreMOVI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // MOVI          move a 12 bit immediate to a register                                           RRI8
+        // sets address reigster at to a constant in the range -2048..2047 encoded in the instruction word
+        // constant is stored in two non-contiguous fields of the instruction word. processor decodes the constant specification
+        // by concatenating the two fields and sign-extending the 12-bit value.
+        // AR[t] = imm12 11 20 || imm12
+        //
+        XTEN_DEBUG_PRINT("\n\tThe instruction is MOVI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t imm12 = ((s << 8) | (opcode >> (CPU->msbFirstOption ? 0 : 16))) & 0xFF;
+        CPU->registerFile[CPU->windowOffset + t] = ((int32_t)imm12 << 20) >> 20;
+    }
+
+    static inline void xten_coreMOVEQZ(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // MOVEQZ        move register if the contents of a register are equal to zero                   RRR
+        // conditianal move if equal to zero. if the contents of at are zero then the processor sets address register ar to the contents
+        // of address register as. otherwise MOVEQZ performs no operation and leaves ar unchanged
+        // if AR[t] = 0^32 then AR[r] = AR[s]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is MOVEQZ\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        if (CPU->registerFile[CPU->windowOffset + t] == 0)
+        {
+            CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
+        }
+    }
+
+    static inline void xten_coreMOVGEZ(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // MOVGEZ       move register if teh contents of a register are greater than or equal to zero   RRR
+        // conditional move if greater than or equal to zero. if contents of at are greater than or equal to zero(most significant bit is clear)
+        // then the processor sets ar to contents of register as. otherwise MOVGEZ performs no operation and leaves address register
+        // ar unchanged
+        // if AR[t] 31 = 0 then AR[r] = AR[s]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is MOVGEZ\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        if ((CPU->registerFile[CPU->windowOffset + t] & 0x80000000) == 0)
+        {
+            CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
+        }
+    }
+
+    static inline void xten_coreMOVLTZ(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // MOVLTZ        move register if the contents of a register are less than zero                  RRR
+        // if the contents of at are less than zero(most isgnificant bit is set), then processor sets
+        // ar to the contents of as MOVLTZ performs no operation and leaves address register ar unchanged
+        // if AR[t] 31 != 0 then AR[r] = AR[s]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is MOVLTZ\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        if ((CPU->registerFile[CPU->windowOffset + t] & 0x80000000) != 0)
+        {
+            CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
         }
+    }
 
-        if (willBranch8)
-        {
-            // branch to target
-            offset = (int8_t)imm8;
-            target = CPU->PC + ((int32_t)offset << 2);
-            CPU->PC = target - 3; // the minus three is required because the CPU->PC will increment at the end of this instruction
-            CPU->addressLines = CPU->PC;
-        }
-        else if (willBranch12)
+    static inline void xten_coreMOVNEZ(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // MOVNEZ        move register if the contents of a register are not zero                        RRR
+        // if contents of at are non-zero processor sets ar to contents of as. otherwise MOVNEZ performs no operation and leaves
+        // ar unchanged
+        // if AR[t] != 0^32 then AR[r] = AR[s]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is MOVNEZ\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        if (CPU->registerFile[CPU->windowOffset + t] != 0)
         {
-            // branch to target
-            int32_t offset = imm12;
-            if (offset & 0x800)
-            {                         // If the sign bit is set
-                offset |= 0xFFFFF000; // Sign extend
-            }
-            CPU->PC = CPU->PC + offset - 3; // the minus three is required because the CPU->PC will increment at the end of this instruction
-            CPU->addressLines = CPU->PC;
+            CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
         }
     }
 
     static inline void xten_coreMoveInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode)
     {
         uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0x0F;
-        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
-        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
-        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
         uint32_t op2 = (opcode >> (CPU->msbFirstOption ? 0 : 20)) & 0x0F;
 
         if (op0 == 0x2)
         {
-            // core Move instructions are
-            // MOVI          move a 12 bit immediate to a register                                           RRI8
-            // sets address reigster at to a constant in the range -2048..2047 encoded in the instruction word
-            // constant is stored in two non-contiguous fields of the instruction word. processor decodes the constant specification
-            // by concatenating the two fields and sign-extending the 12-bit value.
-            // AR[t] = imm12 11 20 || imm12
-            //
-            printf("\n\tThe instruction is MOVI\n");
-            uint32_t imm12 = ((s << 8) | (opcode >> (CPU->msbFirstOption ? 0 : 16))) & 0xFF;
-            CPU->registerFile[CPU->windowOffset + t] = ((int32_t)imm12 << 20) >> 20;
+            xten_coreMOVI(CPU, opcode);
         }
         else if (op0 == 0x0)
         {
             switch (op2)
             {
             case 0x8:
-                // MOVEQZ        move register if the contents of a register are equal to zero                   RRR
-                // conditianal move if equal to zero. if the contents of at are zero then the processor sets address register ar to the contents
-                // of address register as. otherwise MOVEQZ performs no operation and leaves ar unchanged
-                // if AR[t] = 0^32 then AR[r] = AR[s]
-                printf("\n\tThe instruction is MOVEQZ\n");
-                if (CPU->registerFile[CPU->windowOffset + t] == 0)
-                {
-                    CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
-                }
+                xten_coreMOVEQZ(CPU, opcode);
                 break;
             case 0xB:
-                // MOVGEZ       move register if teh contents of a register are greater than or equal to zero   RRR
-                // conditional move if greater than or equal to zero. if contents of at are greater than or equal to zero(most significant bit is clear)
-                // then the processor sets ar to contents of register as. otherwise MOVGEZ performs no operation and leaves address register
-                // ar unchanged
-                // if AR[t] 31 = 0 then AR[r] = AR[s]
-                printf("\n\tThe instruction is MOVGEZ\n");
-                if ((CPU->registerFile[CPU->windowOffset + t] & 0x80000000) == 0)
-                {
-                    CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
-                }
+                xten_coreMOVGEZ(CPU, opcode);
                 break;
             case 0xA:
-                // MOVLTZ        move register if the contents of a register are less than zero                  RRR
-                // if the contents of at are less than zero(most isgnificant bit is set), then processor sets
-                // ar to the contents of as MOVLTZ performs no operation and leaves address register ar unchanged
-                // if AR[t] 31 != 0 then AR[r] = AR[s]
-                printf("\n\tThe instruction is MOVLTZ\n");
-                if ((CPU->registerFile[CPU->windowOffset + t] & 0x80000000) != 0)
-                {
-                    CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
-                }
+                xten_coreMOVLTZ(CPU, opcode);
                 break;
             case 0x9:
-                // MOVNEZ        move register if the contents of a register are not zero                        RRR
-                // if contents of at are non-zero processor sets ar to contents of as. otherwise MOVNEZ performs no operation and leaves
-                // ar unchanged
-                // if AR[t] != 0^32 then AR[r] = AR[s]
-                printf("\n\tThe instruction is MOVNEZ\n");
-                if (CPU->registerFile[CPU->windowOffset + t] != 0)
-                {
-                    CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s];
-                }
+                xten_coreMOVNEZ(CPU, opcode);
                 break;
             default:
-                printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
         }
         else
         {
-            printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            xten_helper_illegalInstruction(CPU);
         }
     }
 
+    static inline void xten_coreADDI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // ADDI      add a register and an 8-bit immediate                                       RRI8
+        // calculates the two's complement 32-bit sum of as and constant in imm8 field assuming sign extended because it is useing twos complement
+        // the low 32 bits of the sum are written to address register at arithmetic overflow is not detected
+        // imm8 ranges from -128 to 127 and is sign-extended imm8
+        // 24 bit instruction
+        // AR[t] = AR[s] + (imm8 7 24||imm8)
+        XTEN_DEBUG_PRINT("\n\tThe instruction is ADDI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        int8_t imm8 = (opcode >> (int8_t)((CPU->msbFirstOption ? 0 : 20)) & 0x0F);
+        CPU->registerFile[CPU->windowOffset + t] = as + imm8;
+    }
+
+    static inline void xten_coreADD(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // ADD       add two registers                                                           RRR
+        // calculates the two's complement 32-bit sum of as and at the low 32 bits are written to ar
+        // arithmetic overflow is not detected
+        // 24 bit instruction
+        // AR[r] = AR[s] + AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is ADD\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as + at;
+    }
+
+    static inline void xten_coreADDX2(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // ADDX2     add two registers with one shifted left by one                              RRR
+        // calculates the two's complement 32-bit sum of as shifted left by one bit and at the low 32bits of the sum are written to ar
+        // arithmetic overflow is not detected
+        // frequently used for address calculation and as part of sequences to bultiply by small constants
+        // AR[r] = (AR[s]30..0||0) + AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is ADDX2\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        as = as << 1;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as + at;
+    }
+
+    static inline void xten_coreADDX4(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // ADDX4     add two registers with one shifted left by two                              RRR
+        // Calculates the two's complement 32-bit sum of as shifted left by two bits and address register at.
+        // low 32 bits of the sum are written to ar no arithmetic overflow detected. frequently used for address calculation and as part
+        // of a sequences to mulitply by small constants
+        // AR[r] = (AR[s] 29..0||0^2) + AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is ADDX4\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        as = as << 2;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as + at;
+    }
+
+    static inline void xten_coreADDX8(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // ADDX8     add two registers with one shifted left by three                            RRR
+        // calculates teh two's complement 32 bit sum of as shifted left by 3 bits and address register at
+        // low 32 bit of the sum are written to ar no arithmetic overflow detected
+        // frequently used for address calculation and part of multiplcation sequence for small constants
+        // AR[r] = (AR[s] 28..0||0^3) + AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is ADDX8\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        as = as << 3;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as + at;
+    }
+
+    static inline void xten_coreSUB(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SUB       subtract two registers                                                      RRR
+        // calculates the two's complement 32 bit difference of as and at the low 32 bits of difference are written to address register ar
+        // no arithmetic overflow detected
+        // AR[r] = AR[s] - AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SUB\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as - at;
+    }
+
+    static inline void xten_coreSUBX2(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SUBX2     subtract two registers with the un-negated one shifted left by one          RRR
+        // calculates the two's complement 32-bit difference of as shifted left byy 1 bit and at. low 32 bits written to ar
+        // no arithmetic overflow detected
+        // frequently used as part of sequences to multiply byy small constants
+        // AR[r] = (AR[s] 30..0||0) - AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SUBX2\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        as = as << 1;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as - at;
+    }
+
+    static inline void xten_coreSUBX4(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SUBX4     subtract two registers with the un-negated one shifted left by two          RRR
+        // calculates the two's complement 32-bit difference of as shifted left by two bits and at. low 32 bits of the difference are written to ar
+        // no arithmetic overflow detected. frequently used for sequences to multiply by small constants
+        // AR[r] = (AR[s] 29..0||0^2) - AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SUBX4\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        as = as << 2;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as - at;
+    }
+
+    static inline void xten_coreSUBX8(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SUBX8     subtract two registers with the un-negated one shifted left by three        RRR
+        // calculates the two's complement 32-bit difference of as shifted left by 3 bits and at
+        // low 32 bits are written to ar no arithmetic overflow detected
+        // AR[r] = (AR[s] 28..0||0^3) - AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SUBX8\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
+        as = as << 3;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = as - at;
+    }
+
+    static inline void xten_coreNEG(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // NEG       negate a register                                                           RRR
+        // calculates the two's complement negation of the contents of at and writes it to ar no arithmetic overflow detected.
+        // AR[r] = 0 - AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is NEG\n");
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = -at;
+    }
+
+    static inline void xten_coreABS(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // ABS       absolute value                                                              RRR
+        // calculates the absolute value of contents of at and writes it to ar no arithmetic overflow detected
+        // AR[r] = if AR[t] 31 then - AR[t] else AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is ABS\n");
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = abs(at);
+    }
+
     static inline void xten_coreArithmeticInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode) // tested ADDI only so far
     {
         uint32_t op0 = (opcode >> (CPU->msbFirstOption ? 20 : 0)) & 0x0F;
@@ -1708,16 +6810,7 @@ extern "C"
         {
             if (r == 0xC)
             {
-                // ADDI      add a register and an 8-bit immediate                                       RRI8
-                // calculates the two's complement 32-bit sum of as and constant in imm8 field assuming sign extended because it is useing twos complement
-                // the low 32 bits of the sum are written to address register at arithmetic overflow is not detected
-                // imm8 ranges from -128 to 127 and is sign-extended imm8
-                // 24 bit instruction
-                // AR[t] = AR[s] + (imm8 7 24||imm8)
-                printf("\n\tThe instruction is ADDI\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                int8_t imm8 = (opcode >> (int8_t)((CPU->msbFirstOption ? 0 : 20)) & 0x0F);
-                CPU->registerFile[CPU->windowOffset + t] = as + imm8;
+                xten_coreADDI(CPU, opcode);
             }
             else if (r == 0XD)
             {
@@ -1729,7 +6822,7 @@ extern "C"
                 // the operand encoded in the instruction can have values that are multiples of 256 ranging from -32768 to 32512
                 // that is decoded from a sign-extending imm8 and shifting the result left by eight bits
                 // AR[t] = AR[s] + (imm8 7 16||imm8||0^8)
-                printf("\n\tThe instruction is ADDMI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is ADDMI\n");
                 int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
                 int8_t imm8 = (opcode >> (int8_t)((CPU->msbFirstOption ? 0 : 20)) & 0x0F);
                 int32_t shiftedImm8 = (int32_t)imm8 << 8;
@@ -1737,7 +6830,8 @@ extern "C"
             }
             else
             {
-                printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                xten_helper_illegalInstruction(CPU);
             }
         }
         else if (op0 == 0x0)
@@ -1745,185 +6839,196 @@ extern "C"
             switch (op2)
             {
             case 0x8:
-            {
-                // ADD       add two registers                                                           RRR
-                // calculates the two's complement 32-bit sum of as and at the low 32 bits are written to ar
-                // arithmetic overflow is not detected
-                // 24 bit instruction
-                // AR[r] = AR[s] + AR[t]
-                printf("\n\tThe instruction is ADD\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as + at;
-            }
-            break;
+                xten_coreADD(CPU, opcode);
+                break;
             case 0x9:
-            {
-                // ADDX2     add two registers with one shifted left by one                              RRR
-                // calculates the two's complement 32-bit sum of as shifted left by one bit and at the low 32bits of the sum are written to ar
-                // arithmetic overflow is not detected
-                // frequently used for address calculation and as part of sequences to bultiply by small constants
-                // AR[r] = (AR[s]30..0||0) + AR[t]
-                printf("\n\tThe instruction is ADDX2\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                as = as << 1;
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as + at;
-            }
-            break;
+                xten_coreADDX2(CPU, opcode);
+                break;
             case 0xA:
-            {
-                // ADDX4     add two registers with one shifted left by two                              RRR
-                // Calculates the two's complement 32-bit sum of as shifted left by two bits and address register at.
-                // low 32 bits of the sum are written to ar no arithmetic overflow detected. frequently used for address calculation and as part
-                // of a sequences to mulitply by small constants
-                // AR[r] = (AR[s] 29..0||0^2) + AR[t]
-                printf("\n\tThe instruction is ADDX4\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                as = as << 2;
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as + at;
-            }
-            break;
+                xten_coreADDX4(CPU, opcode);
+                break;
             case 0xB:
-            {
-                // ADDX8     add two registers with one shifted left by three                            RRR
-                // calculates teh two's complement 32 bit sum of as shifted left by 3 bits and address register at
-                // low 32 bit of the sum are written to ar no arithmetic overflow detected
-                // frequently used for address calculation and part of multiplcation sequence for small constants
-                // AR[r] = (AR[s] 28..0||0^3) + AR[t]
-                printf("\n\tThe instruction is ADDX8\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                as = as << 3;
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as + at;
-            }
-            break;
+                xten_coreADDX8(CPU, opcode);
+                break;
             case 0xC:
-            {
-                // SUB       subtract two registers                                                      RRR
-                // calculates the two's complement 32 bit difference of as and at the low 32 bits of difference are written to address register ar
-                // no arithmetic overflow detected
-                // AR[r] = AR[s] - AR[t]
-                printf("\n\tThe instruction is SUB\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as - at;
-            }
-            break;
+                xten_coreSUB(CPU, opcode);
+                break;
             case 0xD:
-            {
-                // SUBX2     subtract two registers with the un-negated one shifted left by one          RRR
-                // calculates the two's complement 32-bit difference of as shifted left byy 1 bit and at. low 32 bits written to ar
-                // no arithmetic overflow detected
-                // frequently used as part of sequences to multiply byy small constants
-                // AR[r] = (AR[s] 30..0||0) - AR[t]
-                printf("\n\tThe instruction is SUBX2\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                as = as << 1;
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as - at;
-            }
-            break;
+                xten_coreSUBX2(CPU, opcode);
+                break;
             case 0xE:
-            {
-                // SUBX4     subtract two registers with the un-negated one shifted left by two          RRR
-                // calculates the two's complement 32-bit difference of as shifted left by two bits and at. low 32 bits of the difference are written to ar
-                // no arithmetic overflow detected. frequently used for sequences to multiply by small constants
-                // AR[r] = (AR[s] 29..0||0^2) - AR[t]
-                printf("\n\tThe instruction is SUBX4\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                as = as << 2;
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as - at;
-            }
-            break;
+                xten_coreSUBX4(CPU, opcode);
+                break;
             case 0xF:
-            {
-                // SUBX8     subtract two registers with the un-negated one shifted left by three        RRR
-                // calculates the two's complement 32-bit difference of as shifted left by 3 bits and at
-                // low 32 bits are written to ar no arithmetic overflow detected
-                // AR[r] = (AR[s] 28..0||0^3) - AR[t]
-                printf("\n\tThe instruction is SUBX8\n");
-                int32_t as = (int32_t)CPU->registerFile[CPU->windowOffset + s];
-                as = as << 3;
-                int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                CPU->registerFile[CPU->windowOffset + r] = as - at;
-            }
-            break;
+                xten_coreSUBX8(CPU, opcode);
+                break;
             case 0x6:
-            {
                 if (s == 0x0)
                 {
-                    // NEG       negate a register                                                           RRR
-                    // calculates the two's complement negation of the contents of at and writes it to ar no arithmetic overflow detected.
-                    // AR[r] = 0 - AR[t]
-                    printf("\n\tThe instruction is NEG\n");
-                    int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                    CPU->registerFile[CPU->windowOffset + r] = -at;
+                    xten_coreNEG(CPU, opcode);
                 }
                 else if (s == 0x1)
                 {
-                    // ABS       absolute value                                                              RRR
-                    // calculates the absolute value of contents of at and writes it to ar no arithmetic overflow detected
-                    // AR[r] = if AR[t] 31 then - AR[t] else AR[t]
-                    printf("\n\tThe instruction is ABS\n");
-                    int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                    CPU->registerFile[CPU->windowOffset + r] = abs(at);
+                    xten_coreABS(CPU, opcode);
                 }
                 else
                 {
-                    printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                    XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                    xten_helper_illegalInstruction(CPU);
                 }
-            }
-            break;
+                break;
             default:
-                printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
         }
         else
         {
-            printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            xten_helper_illegalInstruction(CPU);
         }
     }
 
-    static inline void xten_coreBitwiseLogicalInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode) // TODO write tests
+    static inline void xten_coreAND(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // AND       bitwise AND of two registers    RRR
+        // calculates bitwise logical and of as and at writing result to ar
+        // AR[r] = AR[s] and AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is AND\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] & CPU->registerFile[CPU->windowOffset + t];
+    }
+
+    static inline void xten_coreOR(Xtensa_lx_CPU *CPU, uint32_t opcode)
     {
+        // OR        bitwise OR two registers        RRR
+        // calculates  the bitwise logical or of as and at writing result to ar
+        // AR[r] = AR[s] or AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is OR\n");
         uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
         uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
         uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] | CPU->registerFile[CPU->windowOffset + t];
+    }
+
+    static inline void xten_coreXOR(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // XOR       bitwise XOR two registers       RRR
+        // calculates the bitwise logical exclusive or of as and at writing result to ar
+        // AR[r] = AR[s] xor AR[t]
+        XTEN_DEBUG_PRINT("\n\tThe instruction is XOR\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] ^ CPU->registerFile[CPU->windowOffset + t];
+    }
+
+    static inline void xten_coreBitwiseLogicalInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode) // TODO write tests
+    {
         uint32_t op2 = (opcode >> (CPU->msbFirstOption ? 0 : 20)) & 0x0F;
 
         switch (op2)
         {
         case 0x1:
-            // AND       bitwise AND of two registers    RRR
-            // calculates bitwise logical and of as and at writing result to ar
-            // AR[r] = AR[s] and AR[t]
-            printf("\n\tThe instruction is AND\n");
-            CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] & CPU->registerFile[CPU->windowOffset + t];
+            xten_coreAND(CPU, opcode);
             break;
         case 0x2:
-            // OR        bitwise OR two registers        RRR
-            // calculates  the bitwise logical or of as and at writing result to ar
-            // AR[r] = AR[s] or AR[t]
-            printf("\n\tThe instruction is OR\n");
-            CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] | CPU->registerFile[CPU->windowOffset + t];
+            xten_coreOR(CPU, opcode);
             break;
         case 0x3:
-            // XOR       bitwise XOR two registers       RRR
-            // calculates the bitwise logical exclusive or of as and at writing result to ar
-            // AR[r] = AR[s] xor AR[t]
-            printf("\n\tThe instruction is XOR\n");
-            CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] ^ CPU->registerFile[CPU->windowOffset + t];
+            xten_coreXOR(CPU, opcode);
             break;
         default:
-            printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+            xten_helper_illegalInstruction(CPU);
             break;
         }
     }
 
+    static inline void xten_coreSRC(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SRC       shift right combined by SAR with two registers as input and one as output           RRR
+        // performs a right shift of the concatenation of as and at by SAR shift amount register least significant 32 bits
+        // of the shift result are written to address register ar. shifts with wider input than output are called funnel shift. SRC directly peforms right funnel shifts.
+        // left funnel shifts are done by swapping the high and low operands to SRC and setting SAR to 32 minus the shift amount. SSL and SSA8B instructions
+        // directly implement such SAR settings. SRC is undefined if SAR > 32.
+        // sa = SAR 5..0
+        // AR[r] = (AR[s]||AR[t]) 31+sa..sa
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SRC\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        uint64_t concat = ((uint64_t)CPU->registerFile[CPU->windowOffset + s] << 32) | CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = concat >> CPU->sar;
+    }
+
+    static inline void xten_coreSLL(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SLL       shift left logical by SAR                                                           RRR
+        // shifts the contents of as left by the number of bit positions specified(as 32 minus number of bit positions) in the SAR
+        // writing the result to ar. loads SAR wqith 32-shift transforming SLL to be implemented in the SRC funnel shifter using the SLL data as the most
+        // significant 32 bits and zero as teh least significant 32 bits.
+        // undefined if SAR > 32.
+        // sa = SAR5..0
+        // AR[r] = (AR[s]||0^32)31+sa..sa
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SLL\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] << (32 - CPU->sar);
+    }
+
+    static inline void xten_coreSRL(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SRL       shift right logical by SAR                                                          RRR
+        // shifts contents of at right inserting zeros on the left by the number of bits specified by the SAR and writes results to ar
+        // SSR or SSA8B are used to load SAE with the shift amount from an address register.
+        // undefined fi SAR > 32
+        // sa = SAR5..0
+        // AR[r] = (0^32||AR[t])31+sa..sa
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SRL\n");
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + t] >> CPU->sar;
+    }
+
+    static inline void xten_coreSRA(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // SRA       shift right logical by SAR                                                          RRR
+        // arighmetically shifts the contents of at right inserting the sign of at on the left by the number of positions specified by SAR
+        // and writes results to ar. typically SSR or SSA8B instructions are used to load SAR with the shift amount from an address reigister.
+        // result is undefined if SAR>32
+        // sa = SAR 5..0
+        XTEN_DEBUG_PRINT("\n\tThe instruction is SRA\n");
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
+        CPU->registerFile[CPU->windowOffset + r] = at >> CPU->sar;
+    }
+
+    static inline void xten_coreEXTUI(Xtensa_lx_CPU *CPU, uint32_t opcode)
+    {
+        // EXTUI     extract field specified by immediates from a register                               RRR
+        // performs unsigned bit field extraction from a 32 bit register value shifts the contents of address register at right by sa
+        // which is split stored in bits 16 11..8 of the instruction word. shift amount is then anded with a mask of maskimm least-significant
+        // 1 bits and result is written to ar. the number of mask bits can be values  1..16 stored in the op2 field as maskimm-1
+        // bits extracted are sa+op2..sa
+        // this operation is undefined for sa+op2 > 31
+        // mask = 0^21-op2||1^op2+1
+        // AR[r] = (0^32||AR[t]) 31+sa..sa and mask
+        XTEN_DEBUG_PRINT("\n\tThe instruction is EXTUI\n");
+        uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+        uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
+        uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+        uint32_t op2 = (opcode >> (CPU->msbFirstOption ? 0 : 20)) & 0x0F;
+        uint32_t op1 = (opcode >> (CPU->msbFirstOption ? 4 : 16)) & 0x0F;
+        uint32_t sa = (op1 & 0x1) << 4 | s; // op1 is 010 followed by the top bit of sa
+        uint32_t mask = (1U << (op2 + 1)) - 1;
+        CPU->registerFile[CPU->windowOffset + r] = (CPU->registerFile[CPU->windowOffset + t] >> sa) & mask;
+    }
+
     static inline void xten_coreShiftInstructions(Xtensa_lx_CPU *CPU, uint32_t opcode) // TODO test
     {
 
@@ -1933,6 +7038,13 @@ extern "C"
         uint32_t op2 = (opcode >> (CPU->msbFirstOption ? 0 : 20)) & 0x0F;
         uint32_t op1 = (opcode >> (CPU->msbFirstOption ? 4 : 16)) & 0x0F;
 
+        if (op1 == 0x4 || op1 == 0x5)
+        {
+            // EXTUI keeps its mask size in op2 so it has to be picked out before op2 is looked at
+            xten_coreEXTUI(CPU, opcode);
+            return;
+        }
+
         if (op2 == 0x4)
         {
             switch (r)
@@ -1943,7 +7055,7 @@ extern "C"
                 // the most significan tbit of SAR is cleared.
                 // sa = AR[s]4..0
                 // SAR = 0||sa
-                printf("\n\tThe instruction is SSR\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is SSR\n");
                 CPU->sar = 0;
                 CPU->sar = CPU->sar | (CPU->registerFile[CPU->windowOffset + s] & 0x1F);
                 break;
@@ -1954,7 +7066,7 @@ extern "C"
                 // input operands perform a left shift
                 // sa=AR[s]4..0
                 // SAR = 32 - (0||sa)
-                printf("\n\tThe instruction is SSL\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is SSL\n");
                 CPU->sar = 0;
                 CPU->sar = CPU->sar | (32 - (CPU->registerFile[CPU->windowOffset + s] & 0x1F));
                 break;
@@ -1965,7 +7077,7 @@ extern "C"
                 // typically used to set up for an SRC isstruction to shift bytes. may be used with little-endian byte ordering to extract unaligned 332-bit values from non
                 // aligned byte address(should not happen in this core architecture)
                 // SAR = 0||AR[s]1..0||0^3
-                printf("\n\tThe instruction is SSA8L\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is SSA8L\n");
                 CPU->sar = (CPU->registerFile[CPU->windowOffset + s] & 0x3) << 3;
                 break;
             case 0x3:
@@ -1977,7 +7089,7 @@ extern "C"
                 // typically used to set up SRC instruction to shift bytes may be used with big-endian byte ordering to extract 32-bit balue from a non-alligned byte
                 // address(should have no unaligned byte addresses in this core architecture)
                 // SAR = 32 - (0||AR[s]1..0||0^3)
-                printf("\n\tThe instruction is SSA8B\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is SSA8B\n");
                 CPU->sar = 32 - ((CPU->registerFile[CPU->windowOffset + s] & 0x3) << 3);
                 break;
             case 0x4:
@@ -1985,7 +7097,7 @@ extern "C"
                 // arithmetically shifts the contents of at right inserting the sign of at on the left by a constant amount encoded in the instruction word in range 0..31
                 // sa field is split with 3 bits 3..0 in bits 11..8 and bit for in bit 20 in the instruction word. sa being shift amount.
                 // AR[r] = ((AR[t]31)^32||AR[t]) 31+sa..sa
-                printf("\n\tThe instruction is SRAI\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is SRAI\n");
                 {
                     int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
                     uint32_t sa = (op2 % 2) << 4 | s;
@@ -1999,7 +7111,7 @@ extern "C"
                     // shifts contents of at right inserting zeros on the left by a constant amound encoded in the instruction word in the range 0..15
                     // no SRLI for shifts >= 16. EXTUI replaces these shifts
                     // AR[r] = (0^32||AR[t])31+sa..sa
-                    printf("\n\tThe instruction is SRLI\n");
+                    XTEN_DEBUG_PRINT("\n\tThe instruction is SRLI\n");
                     {
                         if (s >= 16)
                         {
@@ -2019,7 +7131,8 @@ extern "C"
                         }
                     }
                 }
-                printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
         }
@@ -2028,83 +7141,25 @@ extern "C"
             switch (op2)
             {
             case 0x8:
-                // SRC       shift right combined by SAR with two registers as input and one as output           RRR
-                // performs a right shift of the concatenation of as and at by SAR shift amount register least significant 32 bits
-                // of the shift result are written to address register ar. shifts with wider input than output are called funnel shift. SRC directly peforms right funnel shifts.
-                // left funnel shifts are done by swapping the high and low operands to SRC and setting SAR to 32 minus the shift amount. SSL and SSA8B instructions
-                // directly implement such SAR settings. SRC is undefined if SAR > 32.
-                // sa = SAR 5..0
-                // AR[r] = (AR[s]||AR[t]) 31+sa..sa
-                printf("\n\tThe instruction is SRC\n");
-                {
-                    uint64_t concat = ((uint64_t)CPU->registerFile[CPU->windowOffset + s] << 32) | CPU->registerFile[CPU->windowOffset + t];
-                    CPU->registerFile[CPU->windowOffset + r] = concat >> CPU->sar;
-                }
+                xten_coreSRC(CPU, opcode);
                 break;
             case 0xA:
-                // SLL       shift left logical by SAR                                                           RRR
-                // shifts the contents of as left by the number of bit positions specified(as 32 minus number of bit positions) in the SAR
-                // writing the result to ar. loads SAR wqith 32-shift transforming SLL to be implemented in the SRC funnel shifter using the SLL data as the most
-                // significant 32 bits and zero as teh least significant 32 bits.
-                // undefined if SAR > 32.
-                // sa = SAR5..0
-                // AR[r] = (AR[s]||0^32)31+sa..sa
-                printf("\n\tThe instruction is SLL\n");
-                {
-                    CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] << (32 - CPU->sar);
-                }
+                xten_coreSLL(CPU, opcode);
                 break;
             case 0x9:
-                // SRL       shift right logical by SAR                                                          RRR
-                // shifts contents of at right inserting zeros on the left by the number of bits specified by the SAR and writes results to ar
-                // SSR or SSA8B are used to load SAE with the shift amount from an address register.
-                // undefined fi SAR > 32
-                // sa = SAR5..0
-                // AR[r] = (0^32||AR[t])31+sa..sa
-                printf("\n\tThe instruction is SRL\n");
-                {
-                    CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + t] >> CPU->sar;
-                }
+                xten_coreSRL(CPU, opcode);
                 break;
             case 0xB:
-                // SRA       shift right logical by SAR                                                          RRR
-                // arighmetically shifts the contents of at right inserting the sign of at on the left by the number of positions specified by SAR
-                // and writes results to ar. typically SSR or SSA8B instructions are used to load SAR with the shift amount from an address reigister.
-                // result is undefined if SAR>32
-                // sa = SAR 5..0
-                printf("\n\tThe instruction is SRA\n");
-                {
-                    int32_t at = (int32_t)CPU->registerFile[CPU->windowOffset + t];
-                    CPU->registerFile[CPU->windowOffset + r] = at >> CPU->sar;
-                }
+                xten_coreSRA(CPU, opcode);
                 break;
             default:
-                if (((opcode >> 5) & 0x7) == 0x2)
-                {
-                    // EXTUI     extract field specified by immediates from a register                               RRR
-                    // performs unsigned bit field extraction from a 32 bit register value shifts the contents of address register at right by sa
-                    // which is split stored in bits 16 11..8 of the instruction word. shift amount is then anded with a mask of maskimm least-significant
-                    // 1 bits and result is written to ar. the number of mask bits can be values  1..16 stored in the op2 field as maskimm-1
-                    // bits extracted are sa+op2..sa
-                    // this operation is undefined for sa+op2 > 31
-                    // mask = 0^21-op2||1^op2+1
-                    // AR[r] = (0^32||AR[t]) 31+sa..sa and mask
-                    printf("\n\tThe instruction is EXTUI\n");
-                    {
-                        uint32_t sa = (op1 % 2) << 4 | s;
-                        uint32_t at = CPU->registerFile[CPU->windowOffset + t] >> sa;
-                        uint32_t maskimm = op2 + 1;
-                        uint32_t mask = ((1U << maskimm) - 1);
-                        CPU->registerFile[CPU->windowOffset + r] = at & mask;
-                    }
-                }
                 if (((opcode >> 1) & 0xF) == 0x9)
                 {
                     // SSAI      set SAR to immediate value                                                          RRR
                     // Sets the SAR to a constant the shift amount sa field is split with bits 3..0 in bits 11..8 of the instruction word
                     // and bit 4 in bit 4 of the instruction word. primarily useful to set the shift amount for SRC.
                     // SAR = 0||sa
-                    printf("\n\tThe instruction is SSAI\n");
+                    XTEN_DEBUG_PRINT("\n\tThe instruction is SSAI\n");
                     CPU->sar = (opcode & 0x1F) | s;
                 }
                 else if (((opcode >> 1) & 0xF) == 0x8)
@@ -2115,12 +7170,13 @@ extern "C"
                     // sa encoded as 32-shift when the sa field is 0 the result of this instruction is undefined.
                     // asselmbler encodes this instruction as or when the sa is zero
                     // AR[r] = (AR[s]||0^32) 31+sa..sa
-                    printf("\n\tThe instruction is SLLI\n");
+                    XTEN_DEBUG_PRINT("\n\tThe instruction is SLLI\n");
                     uint32_t sa = (opcode >> 4) & 0xF;
                     sa = sa + ((opcode >> 16) & 0x10);
                     CPU->registerFile[CPU->windowOffset + r] = CPU->registerFile[CPU->windowOffset + s] << sa;
                 }
-                printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
         }
@@ -2131,8 +7187,10 @@ extern "C"
         uint32_t t = (opcode >> (CPU->msbFirstOption ? 16 : 4)) & 0x0F;
         uint32_t op2 = (opcode >> (CPU->msbFirstOption ? 0 : 20)) & 0x0F;
         uint32_t sr = (opcode >> (CPU->msbFirstOption ? 8 : 8)) & 0xFF;
+        uint32_t op1 = (opcode >> (CPU->msbFirstOption ? 4 : 16)) & 0x0F;
 
-        switch (op2)
+        // the SYNC instructions come from RST0 where op2 is zero like RSR so op1 is used to send them to the default case
+        switch ((op1 == 0x0) ? 0xFF : op2)
         {
         case 0x0:
             // RSR       read a special register                                 RSR
@@ -2145,11 +7203,55 @@ extern "C"
             // sr = if msbFirst then s||r else r||s
             // if sr >= 64 and CRING != 0 then exception (privilegedInstructionCause) if expetion option
             // else tables in section 5.3 on page 208
-            printf("\n\tThe instruction is RSR\n");
+            XTEN_DEBUG_PRINT("\n\tThe instruction is RSR\n");
             if (sr == 0x03)
             { // this is the only special register in the core archetecture accessible this way
                 CPU->registerFile[CPU->windowOffset + t] = CPU->sar;
             }
+            else if (sr == CCOUNT_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->ccount;
+            }
+            else if (sr == INTERRUPT_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->interrupt;
+            }
+            else if (sr == INTENABLE_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->intenable;
+            }
+            else if (sr == IBREAKENABLE_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->ibreakenable;
+            }
+            else if (sr >= IBREAKA0_NUM && sr < IBREAKA0_NUM + XTEN_IBREAK_COUNT)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->ibreaka[sr - IBREAKA0_NUM];
+            }
+            else if (sr >= DBREAKA0_NUM && sr < DBREAKA0_NUM + XTEN_DBREAK_COUNT)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->dbreaka[sr - DBREAKA0_NUM];
+            }
+            else if (sr >= DBREAKC0_NUM && sr < DBREAKC0_NUM + XTEN_DBREAK_COUNT)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->dbreakc[sr - DBREAKC0_NUM];
+            }
+            else if (sr == DEBUGCAUSE_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->debugcause;
+            }
+            else if (sr == EXCCAUSE_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->exccause;
+            }
+            else if (sr == EXCVADDR_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->excvaddr;
+            }
+            else if (sr == EPC1_NUM)
+            {
+                CPU->registerFile[CPU->windowOffset + t] = CPU->epc1;
+            }
             break;
         case 0x1:
             // WSR       write a special register                                RSR
@@ -2161,11 +7263,35 @@ extern "C"
             // sr = if msbFirst then s||r else r||s
             // if sr >= 64 and CRING != 0 then exception(privilegedInstructionCause)
             // else see 208
-            printf("\n\tThe instruction is WSR\n");
+            XTEN_DEBUG_PRINT("\n\tThe instruction is WSR\n");
             if (sr == 0x03)
             { // this is the only special register in the core archetecture accessible this way
                 CPU->sar = CPU->registerFile[CPU->windowOffset + t] & 0x1F;
             }
+            else if (sr == CCOUNT_NUM)
+            {
+                CPU->ccount = CPU->registerFile[CPU->windowOffset + t];
+            }
+            else if (sr == INTSET_NUM)
+            {
+                CPU->interrupt |= CPU->registerFile[CPU->windowOffset + t];
+            }
+            else if (sr == INTCLEAR_NUM)
+            {
+                CPU->interrupt &= ~CPU->registerFile[CPU->windowOffset + t];
+            }
+            else if (sr == INTENABLE_NUM)
+            {
+                CPU->intenable = CPU->registerFile[CPU->windowOffset + t];
+            }
+            else if (sr == IBREAKENABLE_NUM || (sr >= IBREAKA0_NUM && sr < IBREAKA0_NUM + XTEN_IBREAK_COUNT))
+            {
+                xten_writeIBreak(CPU, sr, CPU->registerFile[CPU->windowOffset + t]);
+            }
+            else if (sr >= DBREAKA0_NUM && sr < DBREAKC0_NUM + XTEN_DBREAK_COUNT)
+            {
+                xten_writeDBreak(CPU, sr, CPU->registerFile[CPU->windowOffset + t]);
+            }
             break;
         case 0x6:
             // XSR       read and write a special register in an exchange        RRR
@@ -2192,7 +7318,7 @@ extern "C"
             // else
             //   t0 = AR[t]
             //   t1 = see RSR frame of tables on 208
-            printf("\n\tThe instruction is XSR\n");
+            XTEN_DEBUG_PRINT("\n\tThe instruction is XSR\n");
             if (sr == 0x03)
             { // this is the only special register in the core archetecture accessible this way
                 uint32_t at = CPU->registerFile[CPU->windowOffset + t];
@@ -2200,28 +7326,44 @@ extern "C"
                 CPU->sar = at & 0x1F;
             }
             break;
-            // USER defined registers have not been implemented at this point in time
         case 0xE:
             //  RUR       read user special register                              ?
             //  reads TIE state that has been grouped into 32-bit quantities by the TIE user_register statement.
             // register number placed in st field of encoded instruction contents of the TIE user_register designated by
             // the 8 bit number 16*s+t are written to address register ar s and t correspond to respective fields of instruction word
             // AR[r] = user_register[st]
-            printf("\n\tThe instruction is RUR\n");
+            XTEN_DEBUG_PRINT("\n\tThe instruction is RUR\n");
+            {
+                uint32_t s = (opcode >> (CPU->msbFirstOption ? 12 : 8)) & 0x0F;
+                uint32_t r = (opcode >> (CPU->msbFirstOption ? 8 : 12)) & 0x0F;
+                uint32_t st = (s << 4) | t;
+                if (!(CPU->userRegisterMask[st / 32] & (1U << (st % 32))))
+                {
+                    xten_helper_illegalInstruction(CPU); // user registers nobody added are not configured
+                    break;
+                }
+                CPU->registerFile[CPU->windowOffset + r] = CPU->userRegisters[st];
+            }
             break;
-        case 0x3:
+        case 0xF:
             //  WUR       write user special register                             ?
             // writes TIE state that has been grouped into 32-bit quantities by the TIE user_register statement. register
             // number placed in the st field of the encoded instruction. contents of at are written to the TIE user_register designated
             // by the sr field of the instruction word.
             // user_register[sr] = AR[t]
-            printf("\n\tThe instruction is WUR\n");
+            XTEN_DEBUG_PRINT("\n\tThe instruction is WUR\n");
+            if (!(CPU->userRegisterMask[sr / 32] & (1U << (sr % 32))))
+            {
+                xten_helper_illegalInstruction(CPU);
+                break;
+            }
+            CPU->userRegisters[sr] = CPU->registerFile[CPU->windowOffset + t];
             break;
         default:
-            switch (opcode)
+            switch (t)
             {
-                // these last 4 function as nops for now
-            case 0x000200:
+                // RSYNC ESYNC and DSYNC function as nops for now
+            case 0x0:
                 //  ISYNC     wait for instruction-Fetch-related changes to reslove   RRR
                 /*ISYNC waits for all previously fetched load, store, cache, TLB, WSR.*, and XSR.*
                 instructions that affect instruction fetch to be performed before fetching the next instruction. RSYNC, ESYNC, and DSYNC are performed as part of this instruction.
@@ -2240,34 +7382,37 @@ extern "C"
                  WSR.CCOMPAREn
                 See the Special Register Tables in Section 5.3 on page 208 and Section 5.7 on
                 page 240, for a complete description of the ISYNC instruction’s uses.*/
-                // isync()
-                printf("\n\tThe instruction is ISYNC\n");
+                // isync() stores to code pages already invalidated what they overlapped but anything the CPU could not see
+                // like code written through the write callback is picked up here
+                XTEN_DEBUG_PRINT("\n\tThe instruction is ISYNC\n");
+                xten_invalidateAllCode(CPU);
                 break;
-            case 0x010200:
+            case 0x1:
                 //  RSYNC     wait for dispatch related changes to resolve            RRR
                 // waits for all perviously fetched WSR instructions to be perfoemd before interpreting the register fields fo the next instruction
                 // this operation is also performed as part of ISYNC. ESYNC and DSYNC are peroformed as part of this instruction
                 // used after specific WSR calls before using resluts
                 // execution of this instruction is specific to the execution pipeline
-                printf("\n\tThe instruction is RSYNC\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is RSYNC\n");
                 break;
-            case 0x020200:
+            case 0x2:
                 //  ESYNC     wait for execution related changes to resolve           RRR
                 // waits for all perviously fetched WSR and XSR instructions to be performed before next instruction uses any register values
                 // performed as part of ISYNC and RSYNC. DSYNC is performedc as part of this instruction.
                 // used after WSR.EPC* instructions specfic to the pipeline.
-                printf("\n\tThe instruction is ESYNC\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is ESYNC\n");
                 break;
-            case 0x030200:
+            case 0x3:
                 //  DSYNC     wait for data memory related changes to resolve         RRR
                 // waits for all previously fetched WSR.*, XSR.*, WDTLB, and IDTLB instructions to be performed before interpreting the virtual address
                 // of next load or store instruction this is performed as part of ISYNC RSYNC and ESYNC
                 // used for WSR.DBREAKC* and WSR.DBREAKA* instructions
                 // pipeline specific
-                printf("\n\tThe instruction is DSYNC\n");
+                XTEN_DEBUG_PRINT("\n\tThe instruction is DSYNC\n");
                 break;
             default:
-                printf("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                XTEN_DEBUG_PRINT("\nSomething went wrong proceeded to xten_coreMemoryOrderingInstructions without a valid opcode this error could have come from the code being run\n");
+                xten_helper_illegalInstruction(CPU);
                 break;
             }
         }
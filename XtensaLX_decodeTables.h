@@ -0,0 +1,4599 @@
+// Generated by Helper Code/decodeTableGenerator.py from Helper Code/xtensa_core.isa do not edit by hand
+// Included by XtensaLX.h after the handler prototypes
+
+#ifndef XTENSA_LX_DECODE_TABLES_H
+#define XTENSA_LX_DECODE_TABLES_H
+
+/*decoded instructions*/
+enum
+{
+    XTEN_OP_ILLEGAL = 0,
+    XTEN_OP_ILL = 1,
+    XTEN_OP_RET = 2,
+    XTEN_OP_RETW = 3,
+    XTEN_OP_JX = 4,
+    XTEN_OP_JR = 5,
+    XTEN_OP_CALLX0 = 6,
+    XTEN_OP_CALLX4 = 7,
+    XTEN_OP_CALLX8 = 8,
+    XTEN_OP_CALLX12 = 9,
+    XTEN_OP_ISYNC = 10,
+    XTEN_OP_RSYNC = 11,
+    XTEN_OP_ESYNC = 12,
+    XTEN_OP_DSYNC = 13,
+    XTEN_OP_MEMW = 14,
+    XTEN_OP_EXTW = 15,
+    XTEN_OP_AND = 16,
+    XTEN_OP_OR = 17,
+    XTEN_OP_XOR = 18,
+    XTEN_OP_NEG = 19,
+    XTEN_OP_ABS = 20,
+    XTEN_OP_ADD = 21,
+    XTEN_OP_ADDX2 = 22,
+    XTEN_OP_ADDX4 = 23,
+    XTEN_OP_ADDX8 = 24,
+    XTEN_OP_SUB = 25,
+    XTEN_OP_SUBX2 = 26,
+    XTEN_OP_SUBX4 = 27,
+    XTEN_OP_SUBX8 = 28,
+    XTEN_OP_SLLI = 29,
+    XTEN_OP_SRAI = 30,
+    XTEN_OP_SRLI = 31,
+    XTEN_OP_XSR = 32,
+    XTEN_OP_SRC = 33,
+    XTEN_OP_SRL = 34,
+    XTEN_OP_SLL = 35,
+    XTEN_OP_SRA = 36,
+    XTEN_OP_RSR = 37,
+    XTEN_OP_WSR = 38,
+    XTEN_OP_MOVEQZ = 39,
+    XTEN_OP_MOVNEZ = 40,
+    XTEN_OP_MOVLTZ = 41,
+    XTEN_OP_MOVGEZ = 42,
+    XTEN_OP_RUR = 43,
+    XTEN_OP_WUR = 44,
+    XTEN_OP_EXTUI = 45,
+    XTEN_OP_L32R = 46,
+    XTEN_OP_L8UI = 47,
+    XTEN_OP_L16UI = 48,
+    XTEN_OP_L32I = 49,
+    XTEN_OP_S8I = 50,
+    XTEN_OP_S16I = 51,
+    XTEN_OP_S32I = 52,
+    XTEN_OP_L16SI = 53,
+    XTEN_OP_MOVI = 54,
+    XTEN_OP_ADDI = 55,
+    XTEN_OP_CALL0 = 56,
+    XTEN_OP_J = 57,
+    XTEN_OP_BNONE = 58,
+    XTEN_OP_BEQ = 59,
+    XTEN_OP_BLT = 60,
+    XTEN_OP_BLTU = 61,
+    XTEN_OP_BALL = 62,
+    XTEN_OP_BBC = 63,
+    XTEN_OP_BBCI = 64,
+    XTEN_OP_BANY = 65,
+    XTEN_OP_BNE = 66,
+    XTEN_OP_BGE = 67,
+    XTEN_OP_BGEU = 68,
+    XTEN_OP_BNALL = 69,
+    XTEN_OP_BBS = 70,
+    XTEN_OP_BBSI = 71,
+    XTEN_OP_CUST0 = 72,
+    XTEN_OP_CUST1 = 73,
+    XTEN_OP_COUNT = 74
+};
+
+/*which byte order independent fields pick the entry in a secondary table*/
+#define XTEN_SELECT_S 0  // indexed by s
+#define XTEN_SELECT_T 1  // indexed by t
+#define XTEN_SELECT_MN 2 // indexed by m << 2 | n
+#define XTEN_DECODE_SECONDARY_COUNT 5
+
+/*handlers of single instructions*/
+static inline void xten_coreRET(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreJX(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreCALLX0(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreAND(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreOR(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreXOR(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreNEG(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreABS(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreADD(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreADDX2(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreADDX4(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreADDX8(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSUB(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSUBX2(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSUBX4(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSUBX8(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSRC(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSRL(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSLL(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreSRA(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreMOVEQZ(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreMOVNEZ(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreMOVLTZ(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreMOVGEZ(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreEXTUI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreL32R(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreL8UI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreL16UI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreL32I(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreS8I(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreS16I(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreS32I(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreL16SI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreMOVI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreADDI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreCALL0(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreJ(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBNONE(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBEQ(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBLT(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBLTU(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBALL(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBBC(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBBCI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBANY(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBNE(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBGE(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBGEU(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBNALL(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBBS(Xtensa_lx_CPU *CPU, uint32_t opcode);
+static inline void xten_coreBBSI(Xtensa_lx_CPU *CPU, uint32_t opcode);
+
+// X(name, handler) for every instruction in XTEN_OP_* order
+#define XTEN_FOR_EACH_OP(X) \
+    X(ILLEGAL, xten_helper_illegalOpcode) \
+    X(ILL, xten_helper_illegalOpcode) \
+    X(RET, xten_coreRET) \
+    X(RETW, xten_coreJumpCallInstructions) \
+    X(JX, xten_coreJX) \
+    X(JR, xten_coreJumpCallInstructions) \
+    X(CALLX0, xten_coreCALLX0) \
+    X(CALLX4, xten_coreJumpCallInstructions) \
+    X(CALLX8, xten_coreJumpCallInstructions) \
+    X(CALLX12, xten_coreJumpCallInstructions) \
+    X(ISYNC, xten_coreProcessorControlInstructions) \
+    X(RSYNC, xten_coreProcessorControlInstructions) \
+    X(ESYNC, xten_coreProcessorControlInstructions) \
+    X(DSYNC, xten_coreProcessorControlInstructions) \
+    X(MEMW, xten_coreMemoryOrderingInstructions) \
+    X(EXTW, xten_coreMemoryOrderingInstructions) \
+    X(AND, xten_coreAND) \
+    X(OR, xten_coreOR) \
+    X(XOR, xten_coreXOR) \
+    X(NEG, xten_coreNEG) \
+    X(ABS, xten_coreABS) \
+    X(ADD, xten_coreADD) \
+    X(ADDX2, xten_coreADDX2) \
+    X(ADDX4, xten_coreADDX4) \
+    X(ADDX8, xten_coreADDX8) \
+    X(SUB, xten_coreSUB) \
+    X(SUBX2, xten_coreSUBX2) \
+    X(SUBX4, xten_coreSUBX4) \
+    X(SUBX8, xten_coreSUBX8) \
+    X(SLLI, xten_coreShiftInstructions) \
+    X(SRAI, xten_coreShiftInstructions) \
+    X(SRLI, xten_coreShiftInstructions) \
+    X(XSR, xten_coreProcessorControlInstructions) \
+    X(SRC, xten_coreSRC) \
+    X(SRL, xten_coreSRL) \
+    X(SLL, xten_coreSLL) \
+    X(SRA, xten_coreSRA) \
+    X(RSR, xten_coreProcessorControlInstructions) \
+    X(WSR, xten_coreProcessorControlInstructions) \
+    X(MOVEQZ, xten_coreMOVEQZ) \
+    X(MOVNEZ, xten_coreMOVNEZ) \
+    X(MOVLTZ, xten_coreMOVLTZ) \
+    X(MOVGEZ, xten_coreMOVGEZ) \
+    X(RUR, xten_coreProcessorControlInstructions) \
+    X(WUR, xten_coreProcessorControlInstructions) \
+    X(EXTUI, xten_coreEXTUI) \
+    X(L32R, xten_coreL32R) \
+    X(L8UI, xten_coreL8UI) \
+    X(L16UI, xten_coreL16UI) \
+    X(L32I, xten_coreL32I) \
+    X(S8I, xten_coreS8I) \
+    X(S16I, xten_coreS16I) \
+    X(S32I, xten_coreS32I) \
+    X(L16SI, xten_coreL16SI) \
+    X(MOVI, xten_coreMOVI) \
+    X(ADDI, xten_coreADDI) \
+    X(CALL0, xten_coreCALL0) \
+    X(J, xten_coreJ) \
+    X(BNONE, xten_coreBNONE) \
+    X(BEQ, xten_coreBEQ) \
+    X(BLT, xten_coreBLT) \
+    X(BLTU, xten_coreBLTU) \
+    X(BALL, xten_coreBALL) \
+    X(BBC, xten_coreBBC) \
+    X(BBCI, xten_coreBBCI) \
+    X(BANY, xten_coreBANY) \
+    X(BNE, xten_coreBNE) \
+    X(BGE, xten_coreBGE) \
+    X(BGEU, xten_coreBGEU) \
+    X(BNALL, xten_coreBNALL) \
+    X(BBS, xten_coreBBS) \
+    X(BBSI, xten_coreBBSI) \
+    X(CUST0, xten_helper_customInstruction) \
+    X(CUST1, xten_helper_customInstruction)
+
+static const char *const xten_opNames[XTEN_OP_COUNT] = {
+    "ILLEGAL",
+    "ILL",
+    "RET",
+    "RETW",
+    "JX",
+    "JR",
+    "CALLX0",
+    "CALLX4",
+    "CALLX8",
+    "CALLX12",
+    "ISYNC",
+    "RSYNC",
+    "ESYNC",
+    "DSYNC",
+    "MEMW",
+    "EXTW",
+    "AND",
+    "OR",
+    "XOR",
+    "NEG",
+    "ABS",
+    "ADD",
+    "ADDX2",
+    "ADDX4",
+    "ADDX8",
+    "SUB",
+    "SUBX2",
+    "SUBX4",
+    "SUBX8",
+    "SLLI",
+    "SRAI",
+    "SRLI",
+    "XSR",
+    "SRC",
+    "SRL",
+    "SLL",
+    "SRA",
+    "RSR",
+    "WSR",
+    "MOVEQZ",
+    "MOVNEZ",
+    "MOVLTZ",
+    "MOVGEZ",
+    "RUR",
+    "WUR",
+    "EXTUI",
+    "L32R",
+    "L8UI",
+    "L16UI",
+    "L32I",
+    "S8I",
+    "S16I",
+    "S32I",
+    "L16SI",
+    "MOVI",
+    "ADDI",
+    "CALL0",
+    "J",
+    "BNONE",
+    "BEQ",
+    "BLT",
+    "BLTU",
+    "BALL",
+    "BBC",
+    "BBCI",
+    "BANY",
+    "BNE",
+    "BGE",
+    "BGEU",
+    "BNALL",
+    "BBS",
+    "BBSI",
+    "CUST0",
+    "CUST1",
+};
+
+static void (*const xten_opHandlers[XTEN_OP_COUNT])(Xtensa_lx_CPU *CPU, uint32_t opcode) = {
+    xten_helper_illegalOpcode, // ILLEGAL
+    xten_helper_illegalOpcode, // ILL
+    xten_coreRET, // RET
+    xten_coreJumpCallInstructions, // RETW
+    xten_coreJX, // JX
+    xten_coreJumpCallInstructions, // JR
+    xten_coreCALLX0, // CALLX0
+    xten_coreJumpCallInstructions, // CALLX4
+    xten_coreJumpCallInstructions, // CALLX8
+    xten_coreJumpCallInstructions, // CALLX12
+    xten_coreProcessorControlInstructions, // ISYNC
+    xten_coreProcessorControlInstructions, // RSYNC
+    xten_coreProcessorControlInstructions, // ESYNC
+    xten_coreProcessorControlInstructions, // DSYNC
+    xten_coreMemoryOrderingInstructions, // MEMW
+    xten_coreMemoryOrderingInstructions, // EXTW
+    xten_coreAND, // AND
+    xten_coreOR, // OR
+    xten_coreXOR, // XOR
+    xten_coreNEG, // NEG
+    xten_coreABS, // ABS
+    xten_coreADD, // ADD
+    xten_coreADDX2, // ADDX2
+    xten_coreADDX4, // ADDX4
+    xten_coreADDX8, // ADDX8
+    xten_coreSUB, // SUB
+    xten_coreSUBX2, // SUBX2
+    xten_coreSUBX4, // SUBX4
+    xten_coreSUBX8, // SUBX8
+    xten_coreShiftInstructions, // SLLI
+    xten_coreShiftInstructions, // SRAI
+    xten_coreShiftInstructions, // SRLI
+    xten_coreProcessorControlInstructions, // XSR
+    xten_coreSRC, // SRC
+    xten_coreSRL, // SRL
+    xten_coreSLL, // SLL
+    xten_coreSRA, // SRA
+    xten_coreProcessorControlInstructions, // RSR
+    xten_coreProcessorControlInstructions, // WSR
+    xten_coreMOVEQZ, // MOVEQZ
+    xten_coreMOVNEZ, // MOVNEZ
+    xten_coreMOVLTZ, // MOVLTZ
+    xten_coreMOVGEZ, // MOVGEZ
+    xten_coreProcessorControlInstructions, // RUR
+    xten_coreProcessorControlInstructions, // WUR
+    xten_coreEXTUI, // EXTUI
+    xten_coreL32R, // L32R
+    xten_coreL8UI, // L8UI
+    xten_coreL16UI, // L16UI
+    xten_coreL32I, // L32I
+    xten_coreS8I, // S8I
+    xten_coreS16I, // S16I
+    xten_coreS32I, // S32I
+    xten_coreL16SI, // L16SI
+    xten_coreMOVI, // MOVI
+    xten_coreADDI, // ADDI
+    xten_coreCALL0, // CALL0
+    xten_coreJ, // J
+    xten_coreBNONE, // BNONE
+    xten_coreBEQ, // BEQ
+    xten_coreBLT, // BLT
+    xten_coreBLTU, // BLTU
+    xten_coreBALL, // BALL
+    xten_coreBBC, // BBC
+    xten_coreBBCI, // BBCI
+    xten_coreBANY, // BANY
+    xten_coreBNE, // BNE
+    xten_coreBGE, // BGE
+    xten_coreBGEU, // BGEU
+    xten_coreBNALL, // BNALL
+    xten_coreBBS, // BBS
+    xten_coreBBSI, // BBSI
+    xten_helper_customInstruction, // CUST0
+    xten_helper_customInstruction, // CUST1
+};
+
+/*instruction families one for every handler*/
+enum
+{
+    XTEN_FAMILY_ILLEGAL = 0,
+    XTEN_FAMILY_LOAD = 1,
+    XTEN_FAMILY_STORE = 2,
+    XTEN_FAMILY_MEMORY_ORDERING = 3,
+    XTEN_FAMILY_JUMP_CALL = 4,
+    XTEN_FAMILY_CONDITIONAL_BRANCH = 5,
+    XTEN_FAMILY_MOVE = 6,
+    XTEN_FAMILY_ARITHMETIC = 7,
+    XTEN_FAMILY_BITWISE_LOGICAL = 8,
+    XTEN_FAMILY_SHIFT = 9,
+    XTEN_FAMILY_PROCESSOR_CONTROL = 10,
+    XTEN_FAMILY_CUSTOM = 11,
+    XTEN_FAMILY_COUNT = 12
+};
+
+static const char *const xten_familyNames[XTEN_FAMILY_COUNT] = {
+    "illegal",
+    "load",
+    "store",
+    "memoryOrdering",
+    "jumpCall",
+    "conditionalBranch",
+    "move",
+    "arithmetic",
+    "bitwiseLogical",
+    "shift",
+    "processorControl",
+    "custom",
+};
+
+static const uint8_t xten_opFamilies[XTEN_OP_COUNT] = {
+    XTEN_FAMILY_ILLEGAL, // ILLEGAL
+    XTEN_FAMILY_ILLEGAL, // ILL
+    XTEN_FAMILY_JUMP_CALL, // RET
+    XTEN_FAMILY_JUMP_CALL, // RETW
+    XTEN_FAMILY_JUMP_CALL, // JX
+    XTEN_FAMILY_JUMP_CALL, // JR
+    XTEN_FAMILY_JUMP_CALL, // CALLX0
+    XTEN_FAMILY_JUMP_CALL, // CALLX4
+    XTEN_FAMILY_JUMP_CALL, // CALLX8
+    XTEN_FAMILY_JUMP_CALL, // CALLX12
+    XTEN_FAMILY_PROCESSOR_CONTROL, // ISYNC
+    XTEN_FAMILY_PROCESSOR_CONTROL, // RSYNC
+    XTEN_FAMILY_PROCESSOR_CONTROL, // ESYNC
+    XTEN_FAMILY_PROCESSOR_CONTROL, // DSYNC
+    XTEN_FAMILY_MEMORY_ORDERING, // MEMW
+    XTEN_FAMILY_MEMORY_ORDERING, // EXTW
+    XTEN_FAMILY_BITWISE_LOGICAL, // AND
+    XTEN_FAMILY_BITWISE_LOGICAL, // OR
+    XTEN_FAMILY_BITWISE_LOGICAL, // XOR
+    XTEN_FAMILY_ARITHMETIC, // NEG
+    XTEN_FAMILY_ARITHMETIC, // ABS
+    XTEN_FAMILY_ARITHMETIC, // ADD
+    XTEN_FAMILY_ARITHMETIC, // ADDX2
+    XTEN_FAMILY_ARITHMETIC, // ADDX4
+    XTEN_FAMILY_ARITHMETIC, // ADDX8
+    XTEN_FAMILY_ARITHMETIC, // SUB
+    XTEN_FAMILY_ARITHMETIC, // SUBX2
+    XTEN_FAMILY_ARITHMETIC, // SUBX4
+    XTEN_FAMILY_ARITHMETIC, // SUBX8
+    XTEN_FAMILY_SHIFT, // SLLI
+    XTEN_FAMILY_SHIFT, // SRAI
+    XTEN_FAMILY_SHIFT, // SRLI
+    XTEN_FAMILY_PROCESSOR_CONTROL, // XSR
+    XTEN_FAMILY_SHIFT, // SRC
+    XTEN_FAMILY_SHIFT, // SRL
+    XTEN_FAMILY_SHIFT, // SLL
+    XTEN_FAMILY_SHIFT, // SRA
+    XTEN_FAMILY_PROCESSOR_CONTROL, // RSR
+    XTEN_FAMILY_PROCESSOR_CONTROL, // WSR
+    XTEN_FAMILY_MOVE, // MOVEQZ
+    XTEN_FAMILY_MOVE, // MOVNEZ
+    XTEN_FAMILY_MOVE, // MOVLTZ
+    XTEN_FAMILY_MOVE, // MOVGEZ
+    XTEN_FAMILY_PROCESSOR_CONTROL, // RUR
+    XTEN_FAMILY_PROCESSOR_CONTROL, // WUR
+    XTEN_FAMILY_SHIFT, // EXTUI
+    XTEN_FAMILY_LOAD, // L32R
+    XTEN_FAMILY_LOAD, // L8UI
+    XTEN_FAMILY_LOAD, // L16UI
+    XTEN_FAMILY_LOAD, // L32I
+    XTEN_FAMILY_STORE, // S8I
+    XTEN_FAMILY_STORE, // S16I
+    XTEN_FAMILY_STORE, // S32I
+    XTEN_FAMILY_LOAD, // L16SI
+    XTEN_FAMILY_MOVE, // MOVI
+    XTEN_FAMILY_ARITHMETIC, // ADDI
+    XTEN_FAMILY_JUMP_CALL, // CALL0
+    XTEN_FAMILY_JUMP_CALL, // J
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BNONE
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BEQ
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BLT
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BLTU
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BALL
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BBC
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BBCI
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BANY
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BNE
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BGE
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BGEU
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BNALL
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BBS
+    XTEN_FAMILY_CONDITIONAL_BRANCH, // BBSI
+    XTEN_FAMILY_CUSTOM, // CUST0
+    XTEN_FAMILY_CUSTOM, // CUST1
+};
+
+// indexed by op0 | op1 << 4 | op2 << 8 | r << 12 entries with XTEN_DECODE_SECONDARY set name a secondary table
+static const uint8_t xten_decodePrimary[65536] = {
+    0x80, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x2F, 0x00, 0x00, 0x81, 0x82, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x30, 0x00, 0x00, 0x81, 0x82, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x31, 0x00, 0x00, 0x81, 0x82, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x32, 0x00, 0x00, 0x81, 0x82, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x33, 0x00, 0x00, 0x81, 0x82, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x34, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x35, 0x00, 0x00, 0x81, 0x82, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x36, 0x00, 0x00, 0x81, 0x82, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x37, 0x00, 0x00, 0x81, 0x82, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2B, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2D, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x00, 0x81, 0x82, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t xten_decodeSelect[XTEN_DECODE_SECONDARY_COUNT] = {
+    XTEN_SELECT_MN, XTEN_SELECT_MN, XTEN_SELECT_MN, XTEN_SELECT_S, XTEN_SELECT_T,
+};
+
+static const uint8_t xten_decodeSecondary[XTEN_DECODE_SECONDARY_COUNT][16] = {
+    {XTEN_OP_ILL, XTEN_OP_ILL, XTEN_OP_ILL, XTEN_OP_ILL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_RET, XTEN_OP_RETW, XTEN_OP_JX, XTEN_OP_JR, XTEN_OP_CALLX0, XTEN_OP_CALLX4, XTEN_OP_CALLX8, XTEN_OP_CALLX12,},
+    {XTEN_OP_CALL0, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_CALL0, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_CALL0, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_CALL0, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL,},
+    {XTEN_OP_J, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_J, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_J, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_J, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL,},
+    {XTEN_OP_NEG, XTEN_OP_ABS, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL,},
+    {XTEN_OP_ISYNC, XTEN_OP_RSYNC, XTEN_OP_ESYNC, XTEN_OP_DSYNC, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL, XTEN_OP_MEMW, XTEN_OP_EXTW, XTEN_OP_ILLEGAL, XTEN_OP_ILLEGAL,},
+};
+
+#endif
@@ -0,0 +1,1214 @@
+#ifndef XTENSA_LX_ESP8266_H
+#define XTENSA_LX_ESP8266_H
+
+// ESP8266 peripherals for XtensaLX.h
+// Include after XtensaLX.h in one translation unit. Every peripheral block is a device on the CPU bus so a host only maps
+// its RAM and flash and lets xten_esp8266Attach put the 0x6000xxxx registers in place. Blocks that have no model yet keep
+// whatever is written to them so firmware polling configuration registers reads back what it set.
+//
+// The UARTs transmit instantly into a host buffer that is written out in large chunks and receive from a buffer the host
+// hands over up front so log heavy firmware does not pay for a host call per byte. The core architecture has no interrupt
+// option so a pending UART cause only sets its bit in INTERRUPT and firmware has to poll RSR.INTERRUPT or the UART status
+// registers instead of expecting its handler to be entered. Debugger reads of the UART see the next RX byte without taking it.
+//
+// SPI flash is the firmware image file mapped into host memory. The window the flash cache shows at 0x40200000 points
+// straight at that mapping so fetches from flash are as fast as fetches from RAM and opening a multi-MB image costs nothing
+// up front. The flash uses mmap so it needs a unix like host.
+//
+// xten_esp8266AddRomFunctions puts host versions of the common ROM functions at their ROM addresses so firmware that only
+// calls those runs without a dump of the ROM.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifndef MAP_ANONYMOUS // strict ISO C modes such as -std=c11 hide it
+#ifdef MAP_ANON
+#define MAP_ANONYMOUS MAP_ANON
+#elif defined(__linux__)
+#define MAP_ANONYMOUS 0x20 // value on Linux
+#else
+#define MAP_ANONYMOUS 0x1000 // value on macOS and FreeBSD
+#endif
+#endif
+
+#include "XtensaLX.h"
+
+/*ESP8266 address map*/
+#define XTEN_ESP8266_UART0_BASE 0x60000000
+#define XTEN_ESP8266_SPI1_BASE 0x60000100
+#define XTEN_ESP8266_SPI0_BASE 0x60000200
+#define XTEN_ESP8266_GPIO_BASE 0x60000300
+#define XTEN_ESP8266_TIMER_BASE 0x60000600 // FRC1 and FRC2
+#define XTEN_ESP8266_RTC_BASE 0x60000700
+#define XTEN_ESP8266_IO_MUX_BASE 0x60000800
+#define XTEN_ESP8266_UART1_BASE 0x60000F00
+#define XTEN_ESP8266_BLOCK_SIZE 0x100 // bytes of registers in every peripheral block
+#define XTEN_ESP8266_BLOCK_WORDS (XTEN_ESP8266_BLOCK_SIZE / 4)
+#define XTEN_ESP8266_UART_COUNT 2
+
+/*UART defines register offsets and bits from the ESP8266 technical reference*/
+#define XTEN_ESP8266_UART_FIFO 0x00
+#define XTEN_ESP8266_UART_INT_RAW 0x04
+#define XTEN_ESP8266_UART_INT_ST 0x08
+#define XTEN_ESP8266_UART_INT_ENA 0x0C
+#define XTEN_ESP8266_UART_INT_CLR 0x10
+#define XTEN_ESP8266_UART_CLKDIV 0x14
+#define XTEN_ESP8266_UART_STATUS 0x1C
+#define XTEN_ESP8266_UART_CONF0 0x20
+#define XTEN_ESP8266_UART_CONF1 0x24
+#define XTEN_ESP8266_UART_DATE 0x78
+#define XTEN_ESP8266_UART_RXFIFO_FULL 0x001 // INT bit RX FIFO holds at least the CONF1 threshold
+#define XTEN_ESP8266_UART_TXFIFO_EMPTY 0x002 // INT bit TX FIFO is below the CONF1 threshold always set since sending is instant
+#define XTEN_ESP8266_UART_RXFIFO_TOUT 0x100 // INT bit RX FIFO holds bytes and the timeout is enabled
+#define XTEN_ESP8266_UART_RXFIFO_RST 0x20000 // CONF0 bit drops what is in the RX FIFO
+#define XTEN_ESP8266_UART_RX_TOUT_EN 0x80000000 // CONF1 bit enables RXFIFO_TOUT
+#define XTEN_ESP8266_UART_FIFO_SIZE 128
+#define XTEN_ESP8266_UART_TX_BUFFER 4096 // bytes sent before the host stream is written to
+#define XTEN_ESP8266_UART_INUM 5         // interrupt both UARTs share
+
+/*SPI flash defines SPI0 register offsets and command bits from the ESP8266 technical reference*/
+#define XTEN_ESP8266_FLASH_BASE 0x40200000   // where the flash cache shows the flash
+#define XTEN_ESP8266_FLASH_WINDOW 0x100000   // bytes of flash the cache shows at once
+#define XTEN_ESP8266_FLASH_SECTOR 0x1000     // smallest erase
+#define XTEN_ESP8266_FLASH_BLOCK 0x10000     // block erase
+#define XTEN_ESP8266_FLASH_ID 0x1640EF       // JEDEC id of a 4MB Winbond part returned by RDID
+#define XTEN_ESP8266_FLASH_STATUS_WEL 0x02   // status register bit set by WREN
+#define XTEN_ESP8266_FLASH_MISS_CYCLES 50    // rough stall for a 32 byte cache line fill over QIO at 80MHz
+#define XTEN_ESP8266_SPI_CMD 0x00
+#define XTEN_ESP8266_SPI_ADDR 0x04           // bits 23-0 flash address bits 31-24 byte count for READ and PP
+#define XTEN_ESP8266_SPI_RD_STATUS 0x10
+#define XTEN_ESP8266_SPI_W0 0x40             // start of the data buffer W0-W15
+#define XTEN_ESP8266_SPI_DATA_SIZE 64
+#define XTEN_ESP8266_SPI_READ 0x80000000
+#define XTEN_ESP8266_SPI_WREN 0x40000000
+#define XTEN_ESP8266_SPI_WRDI 0x20000000
+#define XTEN_ESP8266_SPI_RDID 0x10000000
+#define XTEN_ESP8266_SPI_RDSR 0x08000000
+#define XTEN_ESP8266_SPI_WRSR 0x04000000
+#define XTEN_ESP8266_SPI_PP 0x02000000
+#define XTEN_ESP8266_SPI_SE 0x01000000
+#define XTEN_ESP8266_SPI_BE 0x00800000
+#define XTEN_ESP8266_SPI_CE 0x00400000
+
+/*ROM function entry points from the SDK linker script eagle.rom.addr.v6.ld*/
+#define XTEN_ESP8266_ROM_ETS_PRINTF 0x400024CC
+#define XTEN_ESP8266_ROM_ETS_MEMSET 0x400018A4
+#define XTEN_ESP8266_ROM_ETS_MEMCPY 0x400018B4
+#define XTEN_ESP8266_ROM_ETS_MEMMOVE 0x400018C4
+#define XTEN_ESP8266_ROM_ETS_MEMCMP 0x400018D4
+#define XTEN_ESP8266_ROM_ETS_DELAY_US 0x40002ECC
+#define XTEN_ESP8266_ROM_UART_TX_ONE_CHAR 0x40003B30
+#define XTEN_ESP8266_ROM_SPI_ERASE_SECTOR 0x40004A00
+#define XTEN_ESP8266_ROM_SPI_WRITE 0x40004A4C
+#define XTEN_ESP8266_ROM_SPI_READ 0x40004B1C
+#define XTEN_ESP8266_ROM_MD5_INIT 0x40009818
+#define XTEN_ESP8266_ROM_MD5_UPDATE 0x40009834
+#define XTEN_ESP8266_ROM_MD5_FINAL 0x40009900
+#define XTEN_ESP8266_ROM_SHA1_INIT 0x4000B584
+#define XTEN_ESP8266_ROM_SHA1_UPDATE 0x4000B5A8
+#define XTEN_ESP8266_ROM_SHA1_FINAL 0x4000B648
+#define XTEN_ESP8266_CPU_MHZ 80           // CCOUNT ticks per microsecond for ets_delay_us
+#define XTEN_ESP8266_ROM_STRING_MAX 1024  // longest string ets_printf prints for one %s
+
+    /*peripheral blocks in the order xten_esp8266BlockBases lists them*/
+    enum
+    {
+        XTEN_ESP8266_UART0,
+        XTEN_ESP8266_SPI1,
+        XTEN_ESP8266_SPI0,
+        XTEN_ESP8266_GPIO,
+        XTEN_ESP8266_TIMER,
+        XTEN_ESP8266_RTC,
+        XTEN_ESP8266_IO_MUX,
+        XTEN_ESP8266_UART1,
+        XTEN_ESP8266_BLOCK_COUNT
+    };
+
+    static const uint32_t xten_esp8266BlockBases[XTEN_ESP8266_BLOCK_COUNT] = {
+        XTEN_ESP8266_UART0_BASE,
+        XTEN_ESP8266_SPI1_BASE,
+        XTEN_ESP8266_SPI0_BASE,
+        XTEN_ESP8266_GPIO_BASE,
+        XTEN_ESP8266_TIMER_BASE,
+        XTEN_ESP8266_RTC_BASE,
+        XTEN_ESP8266_IO_MUX_BASE,
+        XTEN_ESP8266_UART1_BASE,
+    };
+
+    /**
+     * @brief struct representing the registers of one peripheral block
+     */
+    typedef struct Xtensa_lx_Esp8266Registers
+    {
+        uint32_t words[XTEN_ESP8266_BLOCK_WORDS]; // register values as the guest sees them with a 32 bit load
+    } Xtensa_lx_Esp8266Registers;
+
+    /**
+     * @brief struct representing one UART
+     *
+     * The guest RX FIFO is a window over the host input so feeding a whole AT command script costs one call.
+     */
+    typedef struct Xtensa_lx_Esp8266Uart
+    {
+        Xtensa_lx_Esp8266Registers registers;      // configuration registers the live ones are filled in when read
+        FILE *output;                              // stream sent bytes go to NULL drops them
+        uint8_t tx[XTEN_ESP8266_UART_TX_BUFFER];   // sent bytes not yet written to output
+        size_t txUsed;                             // bytes in tx
+        const uint8_t *input;                      // bytes the guest receives owned by the host
+        size_t inputLength;                        // bytes in input
+        size_t inputUsed;                          // bytes of input the guest has read
+        bool interruptPending;                     // an enabled cause was pending after the last access
+    } Xtensa_lx_Esp8266Uart;
+
+    /**
+     * @brief struct representing the SPI flash and the SPI0 controller in front of it
+     *
+     * The image is mapped shared so erases and writes land in the page cache and reach the file whenever the host kernel
+     * writes them back or xten_esp8266FlashSync is called. The mapping is padded with erased bytes up to a whole number of
+     * cache windows.
+     */
+    typedef struct Xtensa_lx_Esp8266Flash
+    {
+        Xtensa_lx_Esp8266Registers registers; // SPI0 registers W0-W15 hold the data bytes in bus order
+        uint8_t *image;                       // flash contents NULL until an image is opened
+        size_t imageSize;                     // bytes of the file
+        size_t mappedSize;                    // bytes of image including the erased padding
+        int fd;                               // the image file
+        bool writeBack;                       // erases and writes reach the file
+        uint32_t window;                      // flash offset shown at XTEN_ESP8266_FLASH_BASE
+        uint32_t status;                      // flash status register
+    } Xtensa_lx_Esp8266Flash;
+
+    /**
+     * @brief struct representing the peripherals of one ESP8266
+     */
+    typedef struct Xtensa_lx_Esp8266
+    {
+        Xtensa_lx_CPU *CPU;                                          // CPU whose bus the peripherals are on
+        Xtensa_lx_Esp8266Registers blocks[XTEN_ESP8266_BLOCK_COUNT]; // one per entry of xten_esp8266BlockBases blocks with a model of their own are unused
+        Xtensa_lx_Esp8266Uart uarts[XTEN_ESP8266_UART_COUNT];        // UART0 and UART1
+        Xtensa_lx_Esp8266Flash flash;                                // SPI flash behind SPI0
+    } Xtensa_lx_Esp8266;
+
+    /**
+     * @brief Reads four bytes of a register block the way the bus hands them to a load
+     *
+     * The byte at offset ends up in the most significant bits so an aligned read gives the register value unchanged. Bytes
+     * past the end of the block read as zero.
+     */
+    static inline uint32_t xten_helper_esp8266ReadRegisters(const uint32_t *words, uint32_t count, uint32_t offset)
+    {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            uint32_t byte = offset + i;
+            value = (value << 8) | ((byte / 4 < count) ? (words[byte / 4] >> (24 - 8 * (byte & 3))) & 0xFF : 0);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Writes the low numBytes bytes of value into a register block the most significant of them at offset
+     */
+    static inline void xten_helper_esp8266WriteRegisters(uint32_t *words, uint32_t count, uint32_t offset, uint32_t value, int numBytes)
+    {
+        for (int i = 0; i < numBytes; i++)
+        {
+            uint32_t byte = offset + (uint32_t)i;
+            if (byte / 4 < count)
+            {
+                uint32_t shift = 24 - 8 * (byte & 3);
+                uint32_t data = (value >> (8 * (numBytes - 1 - i))) & 0xFF;
+                words[byte / 4] = (words[byte / 4] & ~(0xFFU << shift)) | (data << shift);
+            }
+        }
+    }
+
+    static inline uint32_t xten_helper_esp8266BlockRead(Xtensa_lx_CPU *CPU, uint32_t offset, void *device)
+    {
+        (void)CPU;
+        Xtensa_lx_Esp8266Registers *block = (Xtensa_lx_Esp8266Registers *)device;
+        return xten_helper_esp8266ReadRegisters(block->words, XTEN_ESP8266_BLOCK_WORDS, offset);
+    }
+
+    static inline void xten_helper_esp8266BlockWrite(Xtensa_lx_CPU *CPU, uint32_t offset, uint32_t value, int numBytes, void *device)
+    {
+        (void)CPU;
+        Xtensa_lx_Esp8266Registers *block = (Xtensa_lx_Esp8266Registers *)device;
+        xten_helper_esp8266WriteRegisters(block->words, XTEN_ESP8266_BLOCK_WORDS, offset, value, numBytes);
+    }
+
+    /****************************************This section is for the UARTs**************************************************************/
+
+    /**
+     * @brief Writes the buffered bytes a UART sent to its output
+     */
+    static inline void xten_helper_esp8266UartDrain(Xtensa_lx_Esp8266Uart *uart)
+    {
+        if (uart->output != NULL && uart->txUsed != 0)
+        {
+            fwrite(uart->tx, 1, uart->txUsed, uart->output);
+        }
+        uart->txUsed = 0;
+    }
+
+    /**
+     * @brief Queues one byte a UART sends
+     */
+    static inline void xten_helper_esp8266UartSend(Xtensa_lx_Esp8266Uart *uart, uint8_t byte)
+    {
+        uart->tx[uart->txUsed++] = byte;
+        if (uart->txUsed == XTEN_ESP8266_UART_TX_BUFFER)
+        {
+            xten_helper_esp8266UartDrain(uart);
+        }
+    }
+
+    /**
+     * @brief Bytes waiting in the guest RX FIFO
+     */
+    static inline uint32_t xten_helper_esp8266UartRxCount(Xtensa_lx_Esp8266Uart *uart)
+    {
+        size_t left = uart->inputLength - uart->inputUsed;
+        return (left < XTEN_ESP8266_UART_FIFO_SIZE) ? (uint32_t)left : XTEN_ESP8266_UART_FIFO_SIZE;
+    }
+
+    /**
+     * @brief Fills in the status and interrupt registers and raises the UART interrupt when an enabled cause becomes pending
+     *
+     * Raising only sets XTEN_ESP8266_UART_INUM in INTERRUPT since the core has no interrupt vectors to dispatch to.
+     */
+    static inline void xten_helper_esp8266UartUpdate(Xtensa_lx_CPU *CPU, Xtensa_lx_Esp8266Uart *uart)
+    {
+        uint32_t *words = uart->registers.words;
+        uint32_t rxCount = xten_helper_esp8266UartRxCount(uart);
+        uint32_t conf1 = words[XTEN_ESP8266_UART_CONF1 / 4];
+        uint32_t raw = XTEN_ESP8266_UART_TXFIFO_EMPTY;
+        if (rxCount != 0 && rxCount >= (conf1 & 0x7F))
+        {
+            raw |= XTEN_ESP8266_UART_RXFIFO_FULL;
+        }
+        if (rxCount != 0 && (conf1 & XTEN_ESP8266_UART_RX_TOUT_EN))
+        {
+            raw |= XTEN_ESP8266_UART_RXFIFO_TOUT;
+        }
+        uint32_t status = raw & words[XTEN_ESP8266_UART_INT_ENA / 4];
+        words[XTEN_ESP8266_UART_INT_RAW / 4] = raw;
+        words[XTEN_ESP8266_UART_INT_ST / 4] = status;
+        words[XTEN_ESP8266_UART_STATUS / 4] = rxCount; // TXFIFO_CNT stays zero
+        if (status != 0 && !uart->interruptPending)
+        {
+            xten_injectInterrupt(CPU, 1U << XTEN_ESP8266_UART_INUM);
+        }
+        uart->interruptPending = status != 0;
+    }
+
+    static inline uint32_t xten_helper_esp8266UartRead(Xtensa_lx_CPU *CPU, uint32_t offset, void *device)
+    {
+        Xtensa_lx_Esp8266Uart *uart = (Xtensa_lx_Esp8266Uart *)device;
+        uint32_t *words = uart->registers.words;
+        if (CPU->debugRead)
+        {
+            // the debugger sees the byte the FIFO would hand out next without taking it
+            uint32_t fifo = words[XTEN_ESP8266_UART_FIFO / 4];
+            words[XTEN_ESP8266_UART_FIFO / 4] = (uart->inputUsed < uart->inputLength) ? uart->input[uart->inputUsed] : 0;
+            uint32_t value = xten_helper_esp8266ReadRegisters(words, XTEN_ESP8266_BLOCK_WORDS, offset);
+            words[XTEN_ESP8266_UART_FIFO / 4] = fifo;
+            return value;
+        }
+        if (offset < XTEN_ESP8266_UART_FIFO + 4)
+        {
+            words[XTEN_ESP8266_UART_FIFO / 4] = (uart->inputUsed < uart->inputLength) ? uart->input[uart->inputUsed++] : 0;
+        }
+        xten_helper_esp8266UartUpdate(CPU, uart);
+        return xten_helper_esp8266ReadRegisters(words, XTEN_ESP8266_BLOCK_WORDS, offset);
+    }
+
+    static inline void xten_helper_esp8266UartWrite(Xtensa_lx_CPU *CPU, uint32_t offset, uint32_t value, int numBytes, void *device)
+    {
+        Xtensa_lx_Esp8266Uart *uart = (Xtensa_lx_Esp8266Uart *)device;
+        uint32_t *words = uart->registers.words;
+        if (offset < XTEN_ESP8266_UART_FIFO + 4)
+        {
+            // any width of store sends its low byte so S8I and S32I to the FIFO both work
+            xten_helper_esp8266UartSend(uart, (uint8_t)value);
+            return;
+        }
+        xten_helper_esp8266WriteRegisters(words, XTEN_ESP8266_BLOCK_WORDS, offset, value, numBytes);
+        words[XTEN_ESP8266_UART_INT_CLR / 4] = 0; // causes are levels so clearing one that still holds raises it again
+        if (words[XTEN_ESP8266_UART_CONF0 / 4] & XTEN_ESP8266_UART_RXFIFO_RST)
+        {
+            uart->inputUsed += xten_helper_esp8266UartRxCount(uart);
+        }
+        xten_helper_esp8266UartUpdate(CPU, uart);
+    }
+
+    /**
+     * @brief Sets the stream a UART sends to
+     *
+     * @param *board Xtensa_lx_Esp8266 pointer holding the UART
+     * @param index uint32_t 0 or 1
+     * @param output FILE pointer to append sent bytes to or NULL to drop them
+     */
+    void xten_esp8266UartSetOutput(Xtensa_lx_Esp8266 *board, uint32_t index, FILE *output)
+    {
+        xten_helper_esp8266UartDrain(&board->uarts[index]);
+        board->uarts[index].output = output;
+    }
+
+    /**
+     * @brief Hands a UART the bytes it receives
+     *
+     * The guest reads them straight out of data so it has to stay valid until the guest has read them or new input is set.
+     * Anything not read from the previous input is dropped.
+     *
+     * @param *board Xtensa_lx_Esp8266 pointer holding the UART
+     * @param index uint32_t 0 or 1
+     * @param data const uint8_t pointer to the bytes
+     * @param length size_t number of bytes
+     */
+    void xten_esp8266UartSetInput(Xtensa_lx_Esp8266 *board, uint32_t index, const uint8_t *data, size_t length)
+    {
+        Xtensa_lx_Esp8266Uart *uart = &board->uarts[index];
+        uart->input = data;
+        uart->inputLength = length;
+        uart->inputUsed = 0;
+        xten_helper_esp8266UartUpdate(board->CPU, uart);
+    }
+
+    /**
+     * @brief Writes everything the UARTs sent so far to their outputs
+     *
+     * Call before reading the output streams or exiting the output is only written when the buffer fills otherwise.
+     */
+    void xten_esp8266UartFlush(Xtensa_lx_Esp8266 *board)
+    {
+        for (uint32_t i = 0; i < XTEN_ESP8266_UART_COUNT; i++)
+        {
+            xten_helper_esp8266UartDrain(&board->uarts[i]);
+            if (board->uarts[i].output != NULL)
+            {
+                fflush(board->uarts[i].output);
+            }
+        }
+    }
+
+    /****************************************This section is for the SPI flash**************************************************************/
+
+    /**
+     * @brief Clips a flash range to the image and throws away whatever was decoded or translated from it
+     *
+     * @return uint8_t pointer to the first byte or NULL when the range starts past the end of the flash
+     */
+    static inline uint8_t *xten_helper_esp8266FlashRange(Xtensa_lx_CPU *CPU, Xtensa_lx_Esp8266Flash *flash, uint32_t address, uint32_t *length)
+    {
+        if (flash->image == NULL || address >= flash->mappedSize)
+        {
+            return NULL;
+        }
+        if (*length > flash->mappedSize - address)
+        {
+            *length = (uint32_t)(flash->mappedSize - address);
+        }
+        if (address < flash->window + XTEN_ESP8266_FLASH_WINDOW && address + *length > flash->window)
+        {
+            uint32_t start = (address > flash->window) ? address : flash->window;
+            uint32_t end = (address + *length < flash->window + XTEN_ESP8266_FLASH_WINDOW) ? address + *length : flash->window + XTEN_ESP8266_FLASH_WINDOW;
+            xten_invalidateCode(CPU, XTEN_ESP8266_FLASH_BASE + (start - flash->window), end - start);
+        }
+        return flash->image + address;
+    }
+
+    /**
+     * @brief Runs the commands set in SPI_CMD they all finish at once so the register reads back as zero
+     */
+    static inline void xten_helper_esp8266SpiCommand(Xtensa_lx_CPU *CPU, Xtensa_lx_Esp8266Flash *flash)
+    {
+        uint32_t *words = flash->registers.words;
+        uint32_t command = words[XTEN_ESP8266_SPI_CMD / 4];
+        uint32_t address = words[XTEN_ESP8266_SPI_ADDR / 4] & 0xFFFFFF;
+        uint32_t count = words[XTEN_ESP8266_SPI_ADDR / 4] >> 24;
+        count = (count > XTEN_ESP8266_SPI_DATA_SIZE) ? XTEN_ESP8266_SPI_DATA_SIZE : count;
+        uint8_t data[XTEN_ESP8266_SPI_DATA_SIZE];
+        words[XTEN_ESP8266_SPI_CMD / 4] = 0;
+
+        if (command & XTEN_ESP8266_SPI_WREN)
+        {
+            flash->status |= XTEN_ESP8266_FLASH_STATUS_WEL;
+        }
+        if (command & XTEN_ESP8266_SPI_WRDI)
+        {
+            flash->status &= ~(uint32_t)XTEN_ESP8266_FLASH_STATUS_WEL;
+        }
+        if (command & XTEN_ESP8266_SPI_READ)
+        {
+            memset(data, 0xFF, sizeof(data));
+            if (flash->image != NULL && address < flash->mappedSize)
+            {
+                memcpy(data, flash->image + address, (count < flash->mappedSize - address) ? count : flash->mappedSize - address);
+            }
+            for (uint32_t i = 0; i < count; i++)
+            {
+                xten_helper_esp8266WriteRegisters(words, XTEN_ESP8266_BLOCK_WORDS, XTEN_ESP8266_SPI_W0 + i, data[i], 1);
+            }
+        }
+        if (command & XTEN_ESP8266_SPI_RDID)
+        {
+            words[XTEN_ESP8266_SPI_W0 / 4] = XTEN_ESP8266_FLASH_ID;
+        }
+        if (command & XTEN_ESP8266_SPI_RDSR)
+        {
+            words[XTEN_ESP8266_SPI_RD_STATUS / 4] = flash->status;
+        }
+        if (command & XTEN_ESP8266_SPI_WRSR)
+        {
+            flash->status = (words[XTEN_ESP8266_SPI_RD_STATUS / 4] & ~(uint32_t)XTEN_ESP8266_FLASH_STATUS_WEL) | (flash->status & XTEN_ESP8266_FLASH_STATUS_WEL);
+        }
+        if ((command & (XTEN_ESP8266_SPI_PP | XTEN_ESP8266_SPI_SE | XTEN_ESP8266_SPI_BE | XTEN_ESP8266_SPI_CE)) == 0 ||
+            !(flash->status & XTEN_ESP8266_FLASH_STATUS_WEL))
+        {
+            return;
+        }
+        flash->status &= ~(uint32_t)XTEN_ESP8266_FLASH_STATUS_WEL; // every program or erase uses up the write enable
+        uint32_t length = count;
+        uint8_t *bytes = NULL;
+        if (command & XTEN_ESP8266_SPI_PP)
+        {
+            // NOR flash programming only clears bits
+            bytes = xten_helper_esp8266FlashRange(CPU, flash, address, &length);
+            for (uint32_t i = 0; bytes != NULL && i < length; i++)
+            {
+                bytes[i] &= (uint8_t)(xten_helper_esp8266ReadRegisters(words, XTEN_ESP8266_BLOCK_WORDS, XTEN_ESP8266_SPI_W0 + i) >> 24);
+            }
+            return;
+        }
+        if (command & XTEN_ESP8266_SPI_SE)
+        {
+            address &= ~(uint32_t)(XTEN_ESP8266_FLASH_SECTOR - 1);
+            length = XTEN_ESP8266_FLASH_SECTOR;
+        }
+        else if (command & XTEN_ESP8266_SPI_BE)
+        {
+            address &= ~(uint32_t)(XTEN_ESP8266_FLASH_BLOCK - 1);
+            length = XTEN_ESP8266_FLASH_BLOCK;
+        }
+        else
+        {
+            address = 0;
+            length = (uint32_t)flash->mappedSize;
+        }
+        bytes = xten_helper_esp8266FlashRange(CPU, flash, address, &length);
+        if (bytes != NULL)
+        {
+            memset(bytes, 0xFF, length);
+        }
+    }
+
+    static inline uint32_t xten_helper_esp8266SpiRead(Xtensa_lx_CPU *CPU, uint32_t offset, void *device)
+    {
+        (void)CPU;
+        Xtensa_lx_Esp8266Flash *flash = (Xtensa_lx_Esp8266Flash *)device;
+        return xten_helper_esp8266ReadRegisters(flash->registers.words, XTEN_ESP8266_BLOCK_WORDS, offset);
+    }
+
+    static inline void xten_helper_esp8266SpiWrite(Xtensa_lx_CPU *CPU, uint32_t offset, uint32_t value, int numBytes, void *device)
+    {
+        Xtensa_lx_Esp8266Flash *flash = (Xtensa_lx_Esp8266Flash *)device;
+        xten_helper_esp8266WriteRegisters(flash->registers.words, XTEN_ESP8266_BLOCK_WORDS, offset, value, numBytes);
+        if (offset < XTEN_ESP8266_SPI_CMD + 4)
+        {
+            xten_helper_esp8266SpiCommand(CPU, flash);
+        }
+    }
+
+    /**
+     * @brief Picks which part of the flash the cache shows at XTEN_ESP8266_FLASH_BASE
+     *
+     * @param *board Xtensa_lx_Esp8266 pointer with an open flash image
+     * @param offset uint32_t flash offset must be a multiple of XTEN_ESP8266_FLASH_WINDOW
+     * @return bool false if there is no image, the offset is not aligned or is past the end of the flash
+     */
+    bool xten_esp8266FlashMapWindow(Xtensa_lx_Esp8266 *board, uint32_t offset)
+    {
+        Xtensa_lx_Esp8266Flash *flash = &board->flash;
+        if (flash->image == NULL || (offset & (XTEN_ESP8266_FLASH_WINDOW - 1)) != 0 || offset >= flash->mappedSize)
+        {
+            return false;
+        }
+        flash->window = offset;
+        xten_flushFetchCache(board->CPU);
+        return xten_mapMemory(board->CPU, XTEN_ESP8266_FLASH_BASE, XTEN_ESP8266_FLASH_WINDOW, flash->image + offset, XTEN_PAGE_READ);
+    }
+
+    /**
+     * @brief Opens a firmware image as the SPI flash and shows its first window at XTEN_ESP8266_FLASH_BASE
+     *
+     * Nothing is read up front the image is mapped and pages come in as the guest touches them. The flash reads as erased
+     * past the end of the file up to the next whole window.
+     *
+     * @param *board Xtensa_lx_Esp8266 pointer attached to a CPU
+     * @param path const char pointer to the image file
+     * @param writeBack bool erases and writes by the guest change the file when true and only the mapping when false
+     * @return bool false if the file could not be opened or mapped
+     */
+    bool xten_esp8266FlashOpen(Xtensa_lx_Esp8266 *board, const char *path, bool writeBack)
+    {
+        Xtensa_lx_Esp8266Flash *flash = &board->flash;
+        if (flash->image != NULL)
+        {
+            return false;
+        }
+        int fd = open(path, writeBack ? O_RDWR : O_RDONLY);
+        struct stat info;
+        if (fd < 0 || fstat(fd, &info) != 0 || info.st_size == 0 || (uint64_t)info.st_size > 0x1000000)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+            return false;
+        }
+        size_t imageSize = (size_t)info.st_size;
+        size_t mappedSize = (imageSize + XTEN_ESP8266_FLASH_WINDOW - 1) & ~(size_t)(XTEN_ESP8266_FLASH_WINDOW - 1);
+
+        // reserve the padded range as erased anonymous memory then put the file over the start of it
+        uint8_t *image = (uint8_t *)mmap(NULL, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (image == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+        if (mmap(image, imageSize, PROT_READ | PROT_WRITE, MAP_FIXED | (writeBack ? MAP_SHARED : MAP_PRIVATE), fd, 0) == MAP_FAILED)
+        {
+            munmap(image, mappedSize);
+            close(fd);
+            return false;
+        }
+        memset(image + imageSize, 0xFF, mappedSize - imageSize); // the tail of the last file page is never written back
+
+        flash->image = image;
+        flash->imageSize = imageSize;
+        flash->mappedSize = mappedSize;
+        flash->fd = fd;
+        flash->writeBack = writeBack;
+        if (!xten_esp8266FlashMapWindow(board, 0))
+        {
+            munmap(image, mappedSize);
+            close(fd);
+            flash->image = NULL;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Turns the flash cache timing model on for the window at XTEN_ESP8266_FLASH_BASE
+     *
+     * Fetches from flash that miss the modelled 32KB cache add XTEN_ESP8266_FLASH_MISS_CYCLES to CCOUNT. Use
+     * xten_fetchCacheRangeStats with the bounds of a function to see how much it stalls.
+     *
+     * @param *board Xtensa_lx_Esp8266 pointer attached to a CPU
+     * @param lines Xtensa_lx_LineStats pointer to XTEN_ESP8266_FLASH_WINDOW / XTEN_FETCH_CACHE_LINE zeroed counters or NULL
+     * @return bool false if the CPU arena has no room for the model
+     */
+    bool xten_esp8266EnableFlashCache(Xtensa_lx_Esp8266 *board, Xtensa_lx_LineStats *lines)
+    {
+        return xten_enableFetchCache(board->CPU, XTEN_ESP8266_FLASH_BASE, XTEN_ESP8266_FLASH_WINDOW, XTEN_ESP8266_FLASH_MISS_CYCLES, lines);
+    }
+
+    /**
+     * @brief Waits for everything the guest erased or wrote to reach the image file
+     */
+    void xten_esp8266FlashSync(Xtensa_lx_Esp8266 *board)
+    {
+        Xtensa_lx_Esp8266Flash *flash = &board->flash;
+        if (flash->image != NULL && flash->writeBack)
+        {
+            msync(flash->image, flash->imageSize, MS_SYNC);
+        }
+    }
+
+    /**
+     * @brief Syncs and unmaps the flash image
+     *
+     * The CPU keeps pointing at the window so it must not run again after this.
+     */
+    void xten_esp8266FlashClose(Xtensa_lx_Esp8266 *board)
+    {
+        Xtensa_lx_Esp8266Flash *flash = &board->flash;
+        if (flash->image == NULL)
+        {
+            return;
+        }
+        xten_esp8266FlashSync(board);
+        munmap(flash->image, flash->mappedSize);
+        close(flash->fd);
+        flash->image = NULL;
+    }
+
+    /****************************************This section is for the ROM functions**************************************************************/
+
+    /**
+     * @brief struct representing the guest MD5_CTX and SHA1_CTX the ROM hashes work on
+     *
+     * Both are state words followed by a 64 bit count of hashed bits low word first and a 64 byte block buffer. MD5 uses
+     * four state words SHA1 five.
+     */
+    typedef struct Xtensa_lx_Esp8266Digest
+    {
+        uint32_t state[5];
+        uint32_t count[2];
+        uint8_t buffer[64];
+    } Xtensa_lx_Esp8266Digest;
+
+    static inline void xten_helper_esp8266RomMemcpy(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_moveBlock(CPU, xten_nativeArgument(CPU, 0), xten_nativeArgument(CPU, 1), xten_nativeArgument(CPU, 2));
+    }
+
+    static inline void xten_helper_esp8266RomMemset(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_fillBlock(CPU, xten_nativeArgument(CPU, 0), (uint8_t)xten_nativeArgument(CPU, 1), xten_nativeArgument(CPU, 2));
+    }
+
+    static inline void xten_helper_esp8266RomMemcmp(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, (uint32_t)xten_compareBlock(CPU, xten_nativeArgument(CPU, 0), xten_nativeArgument(CPU, 1), xten_nativeArgument(CPU, 2)));
+    }
+
+    static inline void xten_helper_esp8266RomDelayUs(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        CPU->ccount += xten_nativeArgument(CPU, 0) * XTEN_ESP8266_CPU_MHZ;
+    }
+
+    static inline void xten_helper_esp8266RomUartTxOneChar(Xtensa_lx_CPU *CPU, void *context)
+    {
+        Xtensa_lx_Esp8266 *board = (Xtensa_lx_Esp8266 *)context;
+        xten_helper_esp8266UartSend(&board->uarts[0], (uint8_t)xten_nativeArgument(CPU, 0));
+        xten_nativeReturn(CPU, 0); // OK
+    }
+
+    /**
+     * @brief ets_printf into the UART0 buffer
+     *
+     * Handles the conversions the ROM does d i u x X c s p and %% with - 0 and width flags. l is accepted and ignored since
+     * long is 32 bits on the guest. Returns the number of bytes printed.
+     */
+    static inline void xten_helper_esp8266RomPrintf(Xtensa_lx_CPU *CPU, void *context)
+    {
+        Xtensa_lx_Esp8266 *board = (Xtensa_lx_Esp8266 *)context;
+        Xtensa_lx_Esp8266Uart *uart = &board->uarts[0];
+        uint32_t format = xten_nativeArgument(CPU, 0);
+        uint32_t argument = 1;
+        uint32_t count = 0;
+        char text[XTEN_ESP8266_ROM_STRING_MAX + 1];
+        char converted[XTEN_ESP8266_ROM_STRING_MAX + 128];
+        for (uint8_t c = xten_helper_readByte(CPU, format++); c != 0; c = xten_helper_readByte(CPU, format++))
+        {
+            if (c != '%')
+            {
+                xten_helper_esp8266UartSend(uart, c);
+                count++;
+                continue;
+            }
+            char specification[16] = "%";
+            size_t used = 1;
+            c = xten_helper_readByte(CPU, format++);
+            while (c == '-' || c == 'l' || (c >= '0' && c <= '9'))
+            {
+                if (c != 'l' && used < 6)
+                {
+                    specification[used++] = (char)c;
+                }
+                c = xten_helper_readByte(CPU, format++);
+            }
+            int length;
+            switch (c)
+            {
+            case 'd':
+            case 'i':
+                specification[used] = 'd';
+                length = snprintf(converted, sizeof(converted), specification, (int32_t)xten_nativeArgument(CPU, argument++));
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'p':
+                specification[used] = (c == 'p') ? 'x' : (char)c;
+                length = snprintf(converted, sizeof(converted), specification, xten_nativeArgument(CPU, argument++));
+                break;
+            case 'c':
+                specification[used] = 'c';
+                length = snprintf(converted, sizeof(converted), specification, (int)(uint8_t)xten_nativeArgument(CPU, argument++));
+                break;
+            case 's':
+            {
+                uint32_t string = xten_nativeArgument(CPU, argument++);
+                size_t i = 0;
+                while (i < XTEN_ESP8266_ROM_STRING_MAX && (text[i] = (char)xten_helper_readByte(CPU, string + (uint32_t)i)) != 0)
+                {
+                    i++;
+                }
+                text[i] = 0;
+                specification[used] = 's';
+                length = snprintf(converted, sizeof(converted), specification, text);
+                break;
+            }
+            case '%':
+                length = snprintf(converted, sizeof(converted), "%%");
+                break;
+            case 0:
+                format--; // a lone % at the end stops the loop on the next read
+                length = 0;
+                break;
+            default:
+                length = snprintf(converted, sizeof(converted), "%%%c", c);
+                break;
+            }
+            length = (length < (int)sizeof(converted)) ? length : (int)sizeof(converted) - 1;
+            for (int i = 0; i < length; i++)
+            {
+                xten_helper_esp8266UartSend(uart, (uint8_t)converted[i]);
+            }
+            count += (uint32_t)length;
+        }
+        xten_nativeReturn(CPU, count);
+    }
+
+    /**
+     * @brief SPIRead(flash address, destination, size) returns 0 or 1 when the range is past the end of the flash
+     */
+    static inline void xten_helper_esp8266RomSpiRead(Xtensa_lx_CPU *CPU, void *context)
+    {
+        Xtensa_lx_Esp8266Flash *flash = &((Xtensa_lx_Esp8266 *)context)->flash;
+        uint32_t address = xten_nativeArgument(CPU, 0);
+        uint32_t length = xten_nativeArgument(CPU, 2);
+        if (flash->image == NULL || address > flash->mappedSize || length > flash->mappedSize - address)
+        {
+            xten_nativeReturn(CPU, 1);
+            return;
+        }
+        xten_writeBlock(CPU, xten_nativeArgument(CPU, 1), flash->image + address, length);
+        xten_nativeReturn(CPU, 0);
+    }
+
+    /**
+     * @brief SPIWrite(flash address, source, size) programs the flash so bits only go from 1 to 0
+     */
+    static inline void xten_helper_esp8266RomSpiWrite(Xtensa_lx_CPU *CPU, void *context)
+    {
+        Xtensa_lx_Esp8266Flash *flash = &((Xtensa_lx_Esp8266 *)context)->flash;
+        uint32_t address = xten_nativeArgument(CPU, 0);
+        uint32_t source = xten_nativeArgument(CPU, 1);
+        uint32_t length = xten_nativeArgument(CPU, 2);
+        uint32_t clipped = length;
+        uint8_t *bytes = xten_helper_esp8266FlashRange(CPU, flash, address, &clipped);
+        if (bytes == NULL || clipped != length)
+        {
+            xten_nativeReturn(CPU, 1);
+            return;
+        }
+        uint8_t chunk[XTEN_NATIVE_CHUNK];
+        for (uint32_t done = 0; done < length;)
+        {
+            uint32_t size = (length - done < XTEN_NATIVE_CHUNK) ? length - done : XTEN_NATIVE_CHUNK;
+            xten_readBlock(CPU, chunk, source + done, size);
+            for (uint32_t i = 0; i < size; i++)
+            {
+                bytes[done + i] &= chunk[i];
+            }
+            done += size;
+        }
+        xten_nativeReturn(CPU, 0);
+    }
+
+    /**
+     * @brief SPIEraseSector(sector number) sets the 4KB sector to 0xFF
+     */
+    static inline void xten_helper_esp8266RomSpiEraseSector(Xtensa_lx_CPU *CPU, void *context)
+    {
+        Xtensa_lx_Esp8266Flash *flash = &((Xtensa_lx_Esp8266 *)context)->flash;
+        uint32_t sector = xten_nativeArgument(CPU, 0);
+        uint32_t length = XTEN_ESP8266_FLASH_SECTOR;
+        uint8_t *bytes = (sector < 0x100000) ? xten_helper_esp8266FlashRange(CPU, flash, sector * XTEN_ESP8266_FLASH_SECTOR, &length) : NULL;
+        if (bytes == NULL)
+        {
+            xten_nativeReturn(CPU, 1);
+            return;
+        }
+        memset(bytes, 0xFF, length);
+        xten_nativeReturn(CPU, 0);
+    }
+
+    static inline uint32_t xten_helper_esp8266Rotate(uint32_t value, uint32_t bits)
+    {
+        return (value << bits) | (value >> (32 - bits));
+    }
+
+    /**
+     * @brief Hashes one 64 byte block into the MD5 state
+     */
+    static inline void xten_helper_esp8266Md5Block(uint32_t *state, const uint8_t *block)
+    {
+        static const uint32_t constants[64] = {
+            0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE, 0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
+            0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE, 0x6B901122, 0xFD987193, 0xA679438E, 0x49B40821,
+            0xF61E2562, 0xC040B340, 0x265E5A51, 0xE9B6C7AA, 0xD62F105D, 0x02441453, 0xD8A1E681, 0xE7D3FBC8,
+            0x21E1CDE6, 0xC33707D6, 0xF4D50D87, 0x455A14ED, 0xA9E3E905, 0xFCEFA3F8, 0x676F02D9, 0x8D2A4C8A,
+            0xFFFA3942, 0x8771F681, 0x6D9D6122, 0xFDE5380C, 0xA4BEEA44, 0x4BDECFA9, 0xF6BB4B60, 0xBEBFBC70,
+            0x289B7EC6, 0xEAA127FA, 0xD4EF3085, 0x04881D05, 0xD9D4D039, 0xE6DB99E5, 0x1FA27CF8, 0xC4AC5665,
+            0xF4292244, 0x432AFF97, 0xAB9423A7, 0xFC93A039, 0x655B59C3, 0x8F0CCC92, 0xFFEFF47D, 0x85845DD1,
+            0x6FA87E4F, 0xFE2CE6E0, 0xA3014314, 0x4E0811A1, 0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391,
+        };
+        static const uint8_t shifts[16] = {7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
+        uint32_t words[16];
+        for (int i = 0; i < 16; i++)
+        {
+            words[i] = (uint32_t)block[i * 4] | ((uint32_t)block[i * 4 + 1] << 8) | ((uint32_t)block[i * 4 + 2] << 16) | ((uint32_t)block[i * 4 + 3] << 24);
+        }
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        for (int i = 0; i < 64; i++)
+        {
+            uint32_t f;
+            int g;
+            switch (i / 16)
+            {
+            case 0:
+                f = (b & c) | (~b & d);
+                g = i;
+                break;
+            case 1:
+                f = (d & b) | (~d & c);
+                g = (5 * i + 1) % 16;
+                break;
+            case 2:
+                f = b ^ c ^ d;
+                g = (3 * i + 5) % 16;
+                break;
+            default:
+                f = c ^ (b | ~d);
+                g = (7 * i) % 16;
+                break;
+            }
+            uint32_t next = b + xten_helper_esp8266Rotate(a + f + constants[i] + words[g], shifts[(i / 16) * 4 + i % 4]);
+            a = d;
+            d = c;
+            c = b;
+            b = next;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+    }
+
+    /**
+     * @brief Hashes one 64 byte block into the SHA1 state
+     */
+    static inline void xten_helper_esp8266Sha1Block(uint32_t *state, const uint8_t *block)
+    {
+        uint32_t words[80];
+        for (int i = 0; i < 16; i++)
+        {
+            words[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) | ((uint32_t)block[i * 4 + 2] << 8) | block[i * 4 + 3];
+        }
+        for (int i = 16; i < 80; i++)
+        {
+            words[i] = xten_helper_esp8266Rotate(words[i - 3] ^ words[i - 8] ^ words[i - 14] ^ words[i - 16], 1);
+        }
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+        for (int i = 0; i < 80; i++)
+        {
+            uint32_t f;
+            if (i < 20)
+            {
+                f = ((b & c) | (~b & d)) + 0x5A827999;
+            }
+            else if (i < 40)
+            {
+                f = (b ^ c ^ d) + 0x6ED9EBA1;
+            }
+            else if (i < 60)
+            {
+                f = ((b & c) | (b & d) | (c & d)) + 0x8F1BBCDC;
+            }
+            else
+            {
+                f = (b ^ c ^ d) + 0xCA62C1D6;
+            }
+            uint32_t next = xten_helper_esp8266Rotate(a, 5) + f + e + words[i];
+            e = d;
+            d = c;
+            c = xten_helper_esp8266Rotate(b, 30);
+            b = a;
+            a = next;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+    }
+
+    /**
+     * @brief Reads a guest hash context with stateWords state words
+     */
+    static inline void xten_helper_esp8266LoadDigest(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t stateWords, Xtensa_lx_Esp8266Digest *digest)
+    {
+        for (uint32_t i = 0; i < stateWords + 2; i++)
+        {
+            uint32_t word = xten_readMemory(CPU, address + i * 4);
+            if (i < stateWords)
+            {
+                digest->state[i] = word;
+            }
+            else
+            {
+                digest->count[i - stateWords] = word;
+            }
+        }
+        xten_readBlock(CPU, digest->buffer, address + (stateWords + 2) * 4, sizeof(digest->buffer));
+    }
+
+    /**
+     * @brief Writes a hash context back to the guest
+     */
+    static inline void xten_helper_esp8266StoreDigest(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t stateWords, const Xtensa_lx_Esp8266Digest *digest)
+    {
+        for (uint32_t i = 0; i < stateWords + 2; i++)
+        {
+            xten_writeMemory(CPU, address + i * 4, (i < stateWords) ? digest->state[i] : digest->count[i - stateWords], 4);
+        }
+        xten_writeBlock(CPU, address + (stateWords + 2) * 4, digest->buffer, sizeof(digest->buffer));
+    }
+
+    /**
+     * @brief Init(context) for MD5 and SHA1 they only differ in the starting state
+     */
+    static inline void xten_helper_esp8266DigestInit(Xtensa_lx_CPU *CPU, uint32_t stateWords)
+    {
+        Xtensa_lx_Esp8266Digest digest = {{0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0}, {0, 0}, {0}};
+        xten_helper_esp8266StoreDigest(CPU, xten_nativeArgument(CPU, 0), stateWords, &digest);
+    }
+
+    /**
+     * @brief Update(context, data, length) for MD5 and SHA1
+     */
+    static inline void xten_helper_esp8266DigestUpdate(Xtensa_lx_CPU *CPU, uint32_t stateWords, void (*hashBlock)(uint32_t *, const uint8_t *))
+    {
+        Xtensa_lx_Esp8266Digest digest;
+        uint32_t address = xten_nativeArgument(CPU, 0);
+        uint32_t data = xten_nativeArgument(CPU, 1);
+        uint32_t length = xten_nativeArgument(CPU, 2);
+        xten_helper_esp8266LoadDigest(CPU, address, stateWords, &digest);
+        uint32_t used = (digest.count[0] >> 3) & 63;
+        uint32_t before = digest.count[0];
+        digest.count[0] += length << 3;
+        digest.count[1] += (length >> 29) + (digest.count[0] < before);
+        uint8_t chunk[XTEN_NATIVE_CHUNK];
+        for (uint32_t done = 0; done < length;)
+        {
+            uint32_t size = (length - done < XTEN_NATIVE_CHUNK) ? length - done : XTEN_NATIVE_CHUNK;
+            xten_readBlock(CPU, chunk, data + done, size);
+            for (uint32_t i = 0; i < size; i++)
+            {
+                digest.buffer[used++] = chunk[i];
+                if (used == 64)
+                {
+                    hashBlock(digest.state, digest.buffer);
+                    used = 0;
+                }
+            }
+            done += size;
+        }
+        xten_helper_esp8266StoreDigest(CPU, address, stateWords, &digest);
+    }
+
+    /**
+     * @brief Final(result, context) for MD5 and SHA1 pads the message writes the hash and clears the context
+     *
+     * MD5 stores the bit count and the hash little endian SHA1 big endian.
+     */
+    static inline void xten_helper_esp8266DigestFinal(Xtensa_lx_CPU *CPU, uint32_t stateWords, void (*hashBlock)(uint32_t *, const uint8_t *), bool bigEndian)
+    {
+        Xtensa_lx_Esp8266Digest digest;
+        uint32_t result = xten_nativeArgument(CPU, 0);
+        uint32_t address = xten_nativeArgument(CPU, 1);
+        xten_helper_esp8266LoadDigest(CPU, address, stateWords, &digest);
+        uint32_t used = (digest.count[0] >> 3) & 63;
+        digest.buffer[used++] = 0x80;
+        if (used > 56)
+        {
+            memset(digest.buffer + used, 0, 64 - used);
+            hashBlock(digest.state, digest.buffer);
+            used = 0;
+        }
+        memset(digest.buffer + used, 0, 56 - used);
+        uint64_t bits = ((uint64_t)digest.count[1] << 32) | digest.count[0];
+        for (int i = 0; i < 8; i++)
+        {
+            digest.buffer[56 + i] = (uint8_t)(bits >> (bigEndian ? 56 - 8 * i : 8 * i));
+        }
+        hashBlock(digest.state, digest.buffer);
+        uint8_t hash[20];
+        for (uint32_t i = 0; i < stateWords * 4; i++)
+        {
+            uint32_t shift = bigEndian ? 24 - 8 * (i & 3) : 8 * (i & 3);
+            hash[i] = (uint8_t)(digest.state[i / 4] >> shift);
+        }
+        xten_writeBlock(CPU, result, hash, stateWords * 4);
+        memset(&digest, 0, sizeof(digest));
+        xten_helper_esp8266StoreDigest(CPU, address, stateWords, &digest);
+    }
+
+    static inline void xten_helper_esp8266RomMd5Init(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_helper_esp8266DigestInit(CPU, 4);
+    }
+
+    static inline void xten_helper_esp8266RomMd5Update(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_helper_esp8266DigestUpdate(CPU, 4, xten_helper_esp8266Md5Block);
+    }
+
+    static inline void xten_helper_esp8266RomMd5Final(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_helper_esp8266DigestFinal(CPU, 4, xten_helper_esp8266Md5Block, false);
+    }
+
+    static inline void xten_helper_esp8266RomSha1Init(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_helper_esp8266DigestInit(CPU, 5);
+    }
+
+    static inline void xten_helper_esp8266RomSha1Update(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_helper_esp8266DigestUpdate(CPU, 5, xten_helper_esp8266Sha1Block);
+    }
+
+    static inline void xten_helper_esp8266RomSha1Final(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_helper_esp8266DigestFinal(CPU, 5, xten_helper_esp8266Sha1Block, true);
+    }
+
+    /**
+     * @brief Runs the ROM functions firmware calls most on the host
+     *
+     * Calls to them cost one instruction instead of thousands and no ROM dump is needed for them. ets_printf and
+     * uart_tx_one_char send on UART0, the SPI functions work on the flash image and the hashes use the SDK MD5_CTX and
+     * SHA1_CTX layouts. Anything else in the ROM still has to be in guest memory to be called.
+     *
+     * @param *board Xtensa_lx_Esp8266 pointer attached to a CPU
+     * @return bool false if the CPU has no room left for native functions
+     */
+    bool xten_esp8266AddRomFunctions(Xtensa_lx_Esp8266 *board)
+    {
+        static const struct
+        {
+            uint32_t address;
+            NativeFunctionCallback function;
+        } functions[] = {
+            {XTEN_ESP8266_ROM_ETS_PRINTF, xten_helper_esp8266RomPrintf},
+            {XTEN_ESP8266_ROM_ETS_MEMSET, xten_helper_esp8266RomMemset},
+            {XTEN_ESP8266_ROM_ETS_MEMCPY, xten_helper_esp8266RomMemcpy},
+            {XTEN_ESP8266_ROM_ETS_MEMMOVE, xten_helper_esp8266RomMemcpy},
+            {XTEN_ESP8266_ROM_ETS_MEMCMP, xten_helper_esp8266RomMemcmp},
+            {XTEN_ESP8266_ROM_ETS_DELAY_US, xten_helper_esp8266RomDelayUs},
+            {XTEN_ESP8266_ROM_UART_TX_ONE_CHAR, xten_helper_esp8266RomUartTxOneChar},
+            {XTEN_ESP8266_ROM_SPI_ERASE_SECTOR, xten_helper_esp8266RomSpiEraseSector},
+            {XTEN_ESP8266_ROM_SPI_WRITE, xten_helper_esp8266RomSpiWrite},
+            {XTEN_ESP8266_ROM_SPI_READ, xten_helper_esp8266RomSpiRead},
+            {XTEN_ESP8266_ROM_MD5_INIT, xten_helper_esp8266RomMd5Init},
+            {XTEN_ESP8266_ROM_MD5_UPDATE, xten_helper_esp8266RomMd5Update},
+            {XTEN_ESP8266_ROM_MD5_FINAL, xten_helper_esp8266RomMd5Final},
+            {XTEN_ESP8266_ROM_SHA1_INIT, xten_helper_esp8266RomSha1Init},
+            {XTEN_ESP8266_ROM_SHA1_UPDATE, xten_helper_esp8266RomSha1Update},
+            {XTEN_ESP8266_ROM_SHA1_FINAL, xten_helper_esp8266RomSha1Final},
+        };
+        for (size_t i = 0; i < sizeof(functions) / sizeof(functions[0]); i++)
+        {
+            if (!xten_addNativeFunction(board->CPU, functions[i].address, functions[i].function, board))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /****************************************This section is for attaching the peripherals**************************************************************/
+
+    /**
+     * @brief Puts the ESP8266 peripheral blocks on the bus of a CPU
+     *
+     * The UARTs get their model with no output or input, SPI0 gets the flash controller with no image and every other block
+     * starts out as plain registers. A host with a better model for a block can xten_unmapDevice its base and map its own
+     * device there.
+     *
+     * @param *board Xtensa_lx_Esp8266 pointer to the peripherals must live as long as the CPU
+     * @param *CPU Xtensa_lx_CPU pointer to attach them to
+     * @return bool false if a block could not be mapped
+     */
+    bool xten_esp8266Attach(Xtensa_lx_Esp8266 *board, Xtensa_lx_CPU *CPU)
+    {
+        memset(board, 0, sizeof(Xtensa_lx_Esp8266));
+        board->CPU = CPU;
+        for (uint32_t i = 0; i < XTEN_ESP8266_UART_COUNT; i++)
+        {
+            uint32_t *words = board->uarts[i].registers.words;
+            words[XTEN_ESP8266_UART_CLKDIV / 4] = 0x2B6;   // 115200 baud from 80MHz
+            words[XTEN_ESP8266_UART_CONF0 / 4] = 0x1C;     // 8 data bits 1 stop bit
+            words[XTEN_ESP8266_UART_CONF1 / 4] = 0x6060;   // FIFO thresholds
+            words[XTEN_ESP8266_UART_DATE / 4] = 0x062000;
+            xten_helper_esp8266UartUpdate(CPU, &board->uarts[i]);
+        }
+        for (uint32_t i = 0; i < XTEN_ESP8266_BLOCK_COUNT; i++)
+        {
+            bool mapped;
+            if (i == XTEN_ESP8266_UART0 || i == XTEN_ESP8266_UART1)
+            {
+                mapped = xten_mapDevice(CPU, xten_esp8266BlockBases[i], XTEN_ESP8266_BLOCK_SIZE, xten_helper_esp8266UartRead,
+                                        xten_helper_esp8266UartWrite, &board->uarts[i == XTEN_ESP8266_UART1]);
+            }
+            else if (i == XTEN_ESP8266_SPI0)
+            {
+                mapped = xten_mapDevice(CPU, xten_esp8266BlockBases[i], XTEN_ESP8266_BLOCK_SIZE, xten_helper_esp8266SpiRead,
+                                        xten_helper_esp8266SpiWrite, &board->flash);
+            }
+            else
+            {
+                mapped = xten_mapDevice(CPU, xten_esp8266BlockBases[i], XTEN_ESP8266_BLOCK_SIZE, xten_helper_esp8266BlockRead,
+                                        xten_helper_esp8266BlockWrite, &board->blocks[i]);
+            }
+            if (!mapped)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
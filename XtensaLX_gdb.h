@@ -0,0 +1,626 @@
+#ifndef XTENSA_LX_GDB_H
+#define XTENSA_LX_GDB_H
+
+// GDB remote serial protocol stub for XtensaLX.h
+// Include after XtensaLX.h in one translation unit. Needs POSIX sockets so it is for unix like hosts only.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "XtensaLX.h"
+
+/*GDB stub defines*/
+#define XTEN_GDB_PACKET_SIZE 4096 // largest packet accepted or sent
+#define XTEN_GDB_RUN_SLICE 100000 // instructions run between checks for a ^C from the debugger
+#define XTEN_GDB_REGISTER_COUNT 22 // a0-a15 pc sar litbase sr176 sr208 ps the layout xtensa-lx106-elf-gdb expects
+#define XTEN_GDB_SIGINT 2
+#define XTEN_GDB_SIGTRAP 5
+
+    /**
+     * @brief struct representing a connection to a debugger
+     */
+    typedef struct Xtensa_lx_GdbConnection
+    {
+        int fd;                               // connected socket
+        uint8_t input[XTEN_GDB_PACKET_SIZE];  // bytes received but not yet used
+        size_t inputStart;                    // first unused byte of input
+        size_t inputEnd;                      // one past the last received byte of input
+        char packet[XTEN_GDB_PACKET_SIZE];    // payload of the packet being handled
+        char reply[XTEN_GDB_PACKET_SIZE * 2]; // payload of the reply being built
+    } Xtensa_lx_GdbConnection;
+
+    /**
+     * @brief Opens a TCP socket on localhost for a debugger to connect to
+     *
+     * @param port uint16_t port to listen on use `target remote :port` in gdb
+     * @return int listening socket or -1 on failure
+     */
+    int xten_gdbListenTCP(uint16_t port)
+    {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0)
+        {
+            return -1;
+        }
+        int reuse = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK); // never listen on anything but localhost
+        if (bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(fd, 1) < 0)
+        {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    /**
+     * @brief Opens a unix domain socket for a debugger to connect to
+     *
+     * @param path path of the socket file it is replaced if it already exists use `target remote path` in gdb
+     * @return int listening socket or -1 on failure
+     */
+    int xten_gdbListenUnix(const char *path)
+    {
+        struct sockaddr_un address;
+        if (path == NULL || strlen(path) >= sizeof(address.sun_path))
+        {
+            return -1;
+        }
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+        {
+            return -1;
+        }
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strcpy(address.sun_path, path);
+        unlink(path);
+        if (bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(fd, 1) < 0)
+        {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    /**
+     * @brief Gets the next byte from the debugger
+     *
+     * @param wait bool false to return -2 right away if nothing has arrived
+     * @return int the byte, -1 when the connection closed or -2 when nothing arrived and wait was false
+     */
+    static inline int xten_helper_gdbReadByte(Xtensa_lx_GdbConnection *connection, bool wait)
+    {
+        if (connection->inputStart == connection->inputEnd)
+        {
+            ssize_t received;
+            do
+            {
+                received = recv(connection->fd, connection->input, sizeof(connection->input), wait ? 0 : MSG_DONTWAIT);
+            } while (received < 0 && errno == EINTR);
+            if (received < 0 && !wait && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                return -2;
+            }
+            if (received <= 0)
+            {
+                return -1;
+            }
+            connection->inputStart = 0;
+            connection->inputEnd = (size_t)received;
+        }
+        return connection->input[connection->inputStart++];
+    }
+
+    static inline bool xten_helper_gdbWriteAll(Xtensa_lx_GdbConnection *connection, const char *data, size_t length)
+    {
+        while (length > 0)
+        {
+            ssize_t sent = send(connection->fd, data, length, 0);
+            if (sent < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (sent <= 0)
+            {
+                return false;
+            }
+            data += sent;
+            length -= (size_t)sent;
+        }
+        return true;
+    }
+
+    static inline int xten_helper_hexValue(char c)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f')
+        {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F')
+        {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Sends a reply packet and waits for the debugger to acknowledge it
+     */
+    static inline bool xten_helper_gdbSend(Xtensa_lx_GdbConnection *connection, const char *payload)
+    {
+        static const char hex[] = "0123456789abcdef";
+        size_t length = strlen(payload);
+        uint8_t checksum = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            checksum += (uint8_t)payload[i];
+        }
+        char trailer[3] = {'#', hex[checksum >> 4], hex[checksum & 0xF]};
+        for (;;)
+        {
+            if (!xten_helper_gdbWriteAll(connection, "$", 1) || !xten_helper_gdbWriteAll(connection, payload, length) ||
+                !xten_helper_gdbWriteAll(connection, trailer, 3))
+            {
+                return false;
+            }
+            int ack = xten_helper_gdbReadByte(connection, true);
+            if (ack == '+')
+            {
+                return true;
+            }
+            if (ack != '-')
+            {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * @brief Waits for the next packet from the debugger and acknowledges it
+     *
+     * @return int length of the payload left in connection->packet or -1 when the connection closed
+     */
+    static inline int xten_helper_gdbReceive(Xtensa_lx_GdbConnection *connection)
+    {
+        for (;;)
+        {
+            int c;
+            do
+            {
+                c = xten_helper_gdbReadByte(connection, true);
+                if (c < 0)
+                {
+                    return -1;
+                }
+            } while (c != '$');
+
+            size_t length = 0;
+            uint8_t checksum = 0;
+            while ((c = xten_helper_gdbReadByte(connection, true)) != '#')
+            {
+                if (c < 0)
+                {
+                    return -1;
+                }
+                if (length < sizeof(connection->packet) - 1)
+                {
+                    connection->packet[length++] = (char)c;
+                }
+                checksum += (uint8_t)c;
+            }
+            int high = xten_helper_gdbReadByte(connection, true);
+            int low = xten_helper_gdbReadByte(connection, true);
+            if (high < 0 || low < 0)
+            {
+                return -1;
+            }
+            connection->packet[length] = '\0';
+            if (xten_helper_hexValue((char)high) * 16 + xten_helper_hexValue((char)low) == checksum)
+            {
+                xten_helper_gdbWriteAll(connection, "+", 1);
+                return (int)length;
+            }
+            xten_helper_gdbWriteAll(connection, "-", 1);
+        }
+    }
+
+    /**
+     * @brief Parses hex digits up to the first character that is not one
+     */
+    static inline uint32_t xten_helper_gdbParseHex(const char **text)
+    {
+        uint32_t value = 0;
+        int digit;
+        while ((digit = xten_helper_hexValue(**text)) >= 0)
+        {
+            value = (value << 4) | (uint32_t)digit;
+            (*text)++;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Appends a register value in target byte order the way the g and p packets send them
+     */
+    static inline void xten_helper_gdbAppendRegister(Xtensa_lx_CPU *CPU, char *out, uint32_t value)
+    {
+        static const char hex[] = "0123456789abcdef";
+        for (int i = 0; i < 4; i++)
+        {
+            uint8_t byte = (uint8_t)(value >> (CPU->msbFirstOption ? 8 * (3 - i) : 8 * i));
+            out[2 * i] = hex[byte >> 4];
+            out[2 * i + 1] = hex[byte & 0xF];
+        }
+        out[8] = '\0';
+    }
+
+    static inline uint32_t xten_helper_gdbParseRegister(Xtensa_lx_CPU *CPU, const char *text)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            int high = xten_helper_hexValue(text[2 * i]);
+            int low = xten_helper_hexValue(text[2 * i + 1]);
+            uint32_t byte = (high < 0 || low < 0) ? 0 : (uint32_t)(high * 16 + low);
+            value |= byte << (CPU->msbFirstOption ? 8 * (3 - i) : 8 * i);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Reads a register by its number in the layout xtensa-lx106-elf-gdb uses
+     */
+    static inline uint32_t xten_helper_gdbGetRegister(Xtensa_lx_CPU *CPU, uint32_t number)
+    {
+        if (number < REGISTER_WINDOW_SIZE)
+        {
+            return CPU->registerFile[CPU->windowOffset + number];
+        }
+        switch (number)
+        {
+        case 16:
+            return CPU->PC;
+        case 17:
+            return CPU->sar;
+        default:
+            return 0; // litbase sr176 sr208 and ps do not exist in the core architecture
+        }
+    }
+
+    static inline void xten_helper_gdbSetRegister(Xtensa_lx_CPU *CPU, uint32_t number, uint32_t value)
+    {
+        if (number < REGISTER_WINDOW_SIZE)
+        {
+            CPU->registerFile[CPU->windowOffset + number] = value;
+        }
+        else if (number == 16)
+        {
+            CPU->PC = value;
+            CPU->addressLines = value;
+        }
+        else if (number == 17)
+        {
+            CPU->sar = value & 0x3F;
+        }
+    }
+
+    /**
+     * @brief Adds or removes a Z1 hardware breakpoint using a free IBREAKA register
+     */
+    static inline bool xten_helper_gdbHardwareBreakpoint(Xtensa_lx_CPU *CPU, uint32_t address, bool insert)
+    {
+        for (uint32_t i = 0; i < XTEN_IBREAK_COUNT; i++)
+        {
+            bool inUse = CPU->ibreakenable & (1U << i);
+            if (insert ? !inUse : (inUse && CPU->ibreaka[i] == address))
+            {
+                if (insert)
+                {
+                    xten_writeIBreak(CPU, IBREAKA0_NUM + i, address);
+                }
+                xten_writeIBreak(CPU, IBREAKENABLE_NUM, insert ? (CPU->ibreakenable | (1U << i)) : (CPU->ibreakenable & ~(1U << i)));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Adds or removes a Z2, Z3 or Z4 watchpoint using a free DBREAKA and DBREAKC pair
+     *
+     * Data breakpoints cover an aligned power of two of up to 64 bytes so the smallest one holding the whole range is used.
+     */
+    static inline bool xten_helper_gdbWatchpoint(Xtensa_lx_CPU *CPU, uint32_t type, uint32_t address, uint32_t length, bool insert)
+    {
+        uint32_t kind = (type == 2) ? XTEN_DBREAKC_STORE : (type == 3) ? XTEN_DBREAKC_LOAD : (XTEN_DBREAKC_LOAD | XTEN_DBREAKC_STORE);
+        uint32_t size = 1;
+        while (size <= XTEN_DBREAKC_MASK && (address & ~(size - 1)) + size < address + (length == 0 ? 1 : length))
+        {
+            size <<= 1;
+        }
+        if (size > XTEN_DBREAKC_MASK + 1)
+        {
+            return false;
+        }
+        uint32_t control = kind | (~(size - 1) & XTEN_DBREAKC_MASK);
+        for (uint32_t i = 0; i < XTEN_DBREAK_COUNT; i++)
+        {
+            bool inUse = CPU->dbreakc[i] & (XTEN_DBREAKC_LOAD | XTEN_DBREAKC_STORE);
+            if (insert ? !inUse : (CPU->dbreakc[i] == control && CPU->dbreaka[i] == address))
+            {
+                xten_writeDBreak(CPU, DBREAKA0_NUM + i, address);
+                xten_writeDBreak(CPU, DBREAKC0_NUM + i, insert ? control : 0);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Builds the stop reply naming the watchpoint that was hit if any
+     */
+    static inline void xten_helper_gdbStopReply(Xtensa_lx_CPU *CPU, Xtensa_lx_GdbConnection *connection, int signal)
+    {
+        if (signal == XTEN_GDB_SIGTRAP && CPU->stopReason == XTEN_STOP_WATCHPOINT)
+        {
+            uint32_t i = (CPU->debugcause >> XTEN_DEBUGCAUSE_DBNUM_SHIFT) & (XTEN_DBREAK_COUNT - 1);
+            uint32_t kind = CPU->dbreakc[i] & (XTEN_DBREAKC_LOAD | XTEN_DBREAKC_STORE);
+            const char *name = (kind == XTEN_DBREAKC_STORE) ? "watch" : (kind == XTEN_DBREAKC_LOAD) ? "rwatch" : "awatch";
+            snprintf(connection->reply, sizeof(connection->reply), "T%02x%s:%x;", signal, name, CPU->dbreaka[i]);
+            return;
+        }
+        snprintf(connection->reply, sizeof(connection->reply), "S%02x", signal);
+    }
+
+    /**
+     * @brief Runs the CPU until it stops or the debugger sends a ^C
+     *
+     * @return int signal number to report to the debugger or -1 if the connection closed
+     */
+    static inline int xten_helper_gdbContinue(Xtensa_lx_CPU *CPU, Xtensa_lx_GdbConnection *connection)
+    {
+        for (;;)
+        {
+            xten_run(CPU, XTEN_GDB_RUN_SLICE);
+            if (CPU->stopReason != XTEN_STOP_NONE || CPU->chipEnable != XTEN_HIGH)
+            {
+                return XTEN_GDB_SIGTRAP;
+            }
+            int c = xten_helper_gdbReadByte(connection, false);
+            if (c == 0x03)
+            {
+                return XTEN_GDB_SIGINT;
+            }
+            if (c == -1)
+            {
+                return -1;
+            }
+        }
+    }
+
+    /**
+     * @brief Handles one packet and builds the reply
+     *
+     * @return bool false when the debugger asked to detach or kill
+     */
+    static inline bool xten_helper_gdbHandlePacket(Xtensa_lx_CPU *CPU, Xtensa_lx_GdbConnection *connection, int *signal)
+    {
+        static const char hex[] = "0123456789abcdef";
+        const char *packet = connection->packet;
+        char *reply = connection->reply;
+        reply[0] = '\0';
+
+        switch (packet[0])
+        {
+        case '?':
+            xten_helper_gdbStopReply(CPU, connection, *signal);
+            break;
+        case 'g':
+            for (uint32_t i = 0; i < XTEN_GDB_REGISTER_COUNT; i++)
+            {
+                xten_helper_gdbAppendRegister(CPU, reply + 8 * i, xten_helper_gdbGetRegister(CPU, i));
+            }
+            break;
+        case 'G':
+            for (uint32_t i = 0; i < XTEN_GDB_REGISTER_COUNT && strlen(packet + 1) >= 8 * (i + 1); i++)
+            {
+                xten_helper_gdbSetRegister(CPU, i, xten_helper_gdbParseRegister(CPU, packet + 1 + 8 * i));
+            }
+            strcpy(reply, "OK");
+            break;
+        case 'p':
+        {
+            const char *text = packet + 1;
+            xten_helper_gdbAppendRegister(CPU, reply, xten_helper_gdbGetRegister(CPU, xten_helper_gdbParseHex(&text)));
+        }
+        break;
+        case 'P':
+        {
+            const char *text = packet + 1;
+            uint32_t number = xten_helper_gdbParseHex(&text);
+            if (*text == '=' && strlen(text + 1) >= 8)
+            {
+                xten_helper_gdbSetRegister(CPU, number, xten_helper_gdbParseRegister(CPU, text + 1));
+                strcpy(reply, "OK");
+            }
+            else
+            {
+                strcpy(reply, "E01");
+            }
+        }
+        break;
+        case 'm':
+        {
+            const char *text = packet + 1;
+            uint32_t address = xten_helper_gdbParseHex(&text);
+            uint32_t length = (*text == ',') ? (text++, xten_helper_gdbParseHex(&text)) : 0;
+            if (length > (sizeof(connection->reply) - 1) / 2)
+            {
+                length = (sizeof(connection->reply) - 1) / 2;
+            }
+            for (uint32_t i = 0; i < length; i++)
+            {
+                uint8_t byte = xten_helper_debugReadByte(CPU, address + i);
+                reply[2 * i] = hex[byte >> 4];
+                reply[2 * i + 1] = hex[byte & 0xF];
+            }
+            reply[2 * length] = '\0';
+        }
+        break;
+        case 'M':
+        {
+            const char *text = packet + 1;
+            uint32_t address = xten_helper_gdbParseHex(&text);
+            uint32_t length = (*text == ',') ? (text++, xten_helper_gdbParseHex(&text)) : 0;
+            if (*text++ != ':' || strlen(text) < 2 * (size_t)length)
+            {
+                strcpy(reply, "E01");
+                break;
+            }
+            for (uint32_t i = 0; i < length; i++)
+            {
+                // writes go through the store path so any cached instructions they change are invalidated
+                xten_writeMemory(CPU, address + i, (uint32_t)(xten_helper_hexValue(text[2 * i]) * 16 + xten_helper_hexValue(text[2 * i + 1])), 1);
+            }
+            strcpy(reply, "OK");
+        }
+        break;
+        case 's':
+        case 'c':
+        {
+            const char *text = packet + 1;
+            if (*text != '\0')
+            {
+                xten_helper_gdbSetRegister(CPU, 16, xten_helper_gdbParseHex(&text));
+            }
+            if (packet[0] == 's')
+            {
+                xten_step(CPU);
+                *signal = XTEN_GDB_SIGTRAP;
+            }
+            else
+            {
+                *signal = xten_helper_gdbContinue(CPU, connection);
+                if (*signal < 0)
+                {
+                    return false;
+                }
+            }
+            xten_helper_gdbStopReply(CPU, connection, *signal);
+        }
+        break;
+        case 'Z':
+        case 'z':
+        {
+            const char *text = packet + 1;
+            uint32_t type = xten_helper_gdbParseHex(&text);
+            uint32_t address = (*text == ',') ? (text++, xten_helper_gdbParseHex(&text)) : 0;
+            uint32_t length = (*text == ',') ? (text++, xten_helper_gdbParseHex(&text)) : 0;
+            bool insert = packet[0] == 'Z';
+            bool done = false;
+            if (type == 0)
+            {
+                done = insert ? xten_addBreakpoint(CPU, address) : (xten_removeBreakpoint(CPU, address), true);
+            }
+            else if (type == 1)
+            {
+                done = xten_helper_gdbHardwareBreakpoint(CPU, address, insert);
+            }
+            else if (type <= 4)
+            {
+                done = xten_helper_gdbWatchpoint(CPU, type, address, length, insert);
+            }
+            else
+            {
+                break; // empty reply tells the debugger this kind is not supported
+            }
+            strcpy(reply, done ? "OK" : "E01");
+        }
+        break;
+        case 'H':
+            strcpy(reply, "OK");
+            break;
+        case 'q':
+            if (strncmp(packet, "qSupported", 10) == 0)
+            {
+                snprintf(reply, sizeof(connection->reply), "PacketSize=%x", XTEN_GDB_PACKET_SIZE);
+            }
+            else if (strcmp(packet, "qAttached") == 0)
+            {
+                strcpy(reply, "1");
+            }
+            break;
+        case 'D':
+            xten_helper_gdbSend(connection, "OK");
+            return false;
+        case 'k':
+            return false;
+        default:
+            break; // empty reply for anything not supported
+        }
+        return xten_helper_gdbSend(connection, reply);
+    }
+
+    /**
+     * @brief Serves one debugger session
+     *
+     * This function waits for a debugger to connect on a socket from xten_gdbListenTCP or xten_gdbListenUnix and handles its
+     * requests until it detaches, kills the session or disconnects. The CPU only runs when the debugger asks it to. Breakpoints
+     * are flags on decoded instructions and watchpoints are flags on pages so continuing runs at the same speed as xten_run does
+     * without a debugger.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer to debug
+     * @param listenFd int listening socket
+     * @return bool false if no debugger could be accepted
+     */
+    bool xten_gdbServe(Xtensa_lx_CPU *CPU, int listenFd)
+    {
+        Xtensa_lx_GdbConnection *connection = (Xtensa_lx_GdbConnection *)calloc(1, sizeof(Xtensa_lx_GdbConnection));
+        if (connection == NULL)
+        {
+            return false;
+        }
+        connection->fd = accept(listenFd, NULL, NULL);
+        if (connection->fd < 0)
+        {
+            free(connection);
+            return false;
+        }
+
+        int signal = XTEN_GDB_SIGTRAP;
+        while (xten_helper_gdbReceive(connection) >= 0 && xten_helper_gdbHandlePacket(CPU, connection, &signal))
+        {
+        }
+
+        close(connection->fd);
+        free(connection);
+        return true;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
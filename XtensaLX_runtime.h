@@ -0,0 +1,600 @@
+#ifndef XTENSA_LX_RUNTIME_H
+#define XTENSA_LX_RUNTIME_H
+
+// Native replacements for the libgcc and newlib functions firmware links in for XtensaLX.h
+// Include after XtensaLX.h in one translation unit. The LX106 has no FPU and no divider so every float operation and
+// every division is a call into libgcc that runs hundreds of guest instructions. xten_addRuntimeFunctions finds those
+// functions in the symbol table of the firmware ELF and runs host code for every call to them instead.
+//
+// Float results match the guest libraries as long as the host does IEEE single and double arithmetic without extended
+// precision which every x86-64 and ARM host does. NaN payloads can differ.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "XtensaLX.h"
+
+/*ELF defines*/
+#define XTEN_ELF_HEADER_SIZE 52
+#define XTEN_ELF_SECTION_SIZE 40
+#define XTEN_ELF_SYMBOL_SIZE 16
+#define XTEN_ELF_SHT_SYMTAB 2
+#define XTEN_ELF_STT_FUNC 2
+
+    /**
+     * @brief struct representing the symbol table of an ELF32 image held by the host
+     */
+    typedef struct Xtensa_lx_ElfSymbols
+    {
+        const uint8_t *image; // whole ELF file must outlive this struct
+        size_t size;          // bytes of image
+        bool bigEndian;       // byte order of the headers
+        uint32_t symbols;     // offset of the first symbol
+        uint32_t symbolCount; // entries in the symbol table
+        uint32_t strings;     // offset of the string table symbol names point into
+        uint32_t stringsSize; // bytes of the string table
+    } Xtensa_lx_ElfSymbols;
+
+    /****************************************This section is for reading ELF symbols**************************************************************/
+
+    static inline uint32_t xten_helper_elfRead(const Xtensa_lx_ElfSymbols *elf, size_t offset, int numBytes)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < numBytes; i++)
+        {
+            uint32_t byte = elf->image[offset + (elf->bigEndian ? i : numBytes - 1 - i)];
+            value = (value << 8) | byte;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Finds the symbol table of an ELF32 file
+     *
+     * @param *elf Xtensa_lx_ElfSymbols pointer to fill in
+     * @param image the whole file in host memory
+     * @param size size_t bytes of image
+     * @return bool false if image is not an ELF32 file or has no symbol table
+     */
+    bool xten_elfLoadSymbols(Xtensa_lx_ElfSymbols *elf, const uint8_t *image, size_t size)
+    {
+        memset(elf, 0, sizeof(Xtensa_lx_ElfSymbols));
+        // 32 bit class and either byte order
+        if (size < XTEN_ELF_HEADER_SIZE || memcmp(image, "\177ELF", 4) != 0 || image[4] != 1 || (image[5] != 1 && image[5] != 2))
+        {
+            return false;
+        }
+        elf->image = image;
+        elf->size = size;
+        elf->bigEndian = image[5] == 2;
+        uint32_t sections = xten_helper_elfRead(elf, 32, 4);
+        uint32_t sectionCount = xten_helper_elfRead(elf, 48, 2);
+        if (xten_helper_elfRead(elf, 46, 2) != XTEN_ELF_SECTION_SIZE || sections > size ||
+            (size - sections) / XTEN_ELF_SECTION_SIZE < sectionCount)
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < sectionCount; i++)
+        {
+            size_t section = sections + (size_t)i * XTEN_ELF_SECTION_SIZE;
+            uint32_t link = xten_helper_elfRead(elf, section + 24, 4);
+            if (xten_helper_elfRead(elf, section + 4, 4) != XTEN_ELF_SHT_SYMTAB || link >= sectionCount)
+            {
+                continue;
+            }
+            size_t stringSection = sections + (size_t)link * XTEN_ELF_SECTION_SIZE;
+            uint32_t symbols = xten_helper_elfRead(elf, section + 16, 4);
+            uint32_t symbolsSize = xten_helper_elfRead(elf, section + 20, 4);
+            uint32_t strings = xten_helper_elfRead(elf, stringSection + 16, 4);
+            uint32_t stringsSize = xten_helper_elfRead(elf, stringSection + 20, 4);
+            if (symbols > size || symbolsSize > size - symbols || strings > size || stringsSize > size - strings)
+            {
+                return false;
+            }
+            elf->symbols = symbols;
+            elf->symbolCount = symbolsSize / XTEN_ELF_SYMBOL_SIZE;
+            elf->strings = strings;
+            elf->stringsSize = stringsSize;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Looks up the address of a function defined in the image
+     *
+     * @return bool false if there is no defined function called name
+     */
+    bool xten_elfFindSymbol(const Xtensa_lx_ElfSymbols *elf, const char *name, uint32_t *address)
+    {
+        size_t length = strlen(name);
+        for (uint32_t i = 0; i < elf->symbolCount; i++)
+        {
+            size_t symbol = elf->symbols + (size_t)i * XTEN_ELF_SYMBOL_SIZE;
+            uint32_t nameOffset = xten_helper_elfRead(elf, symbol, 4);
+            if ((elf->image[symbol + 12] & 0xF) != XTEN_ELF_STT_FUNC || xten_helper_elfRead(elf, symbol + 14, 2) == 0 ||
+                nameOffset >= elf->stringsSize || elf->stringsSize - nameOffset <= length)
+            {
+                continue;
+            }
+            const char *symbolName = (const char *)elf->image + elf->strings + nameOffset;
+            if (memcmp(symbolName, name, length + 1) == 0)
+            {
+                *address = xten_helper_elfRead(elf, symbol + 4, 4);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief xten_addNativeFunction for the function an ELF symbol names
+     *
+     * @return bool false if the symbol is missing or the native function table is full
+     */
+    bool xten_addNativeSymbol(Xtensa_lx_CPU *CPU, const Xtensa_lx_ElfSymbols *elf, const char *name, NativeFunctionCallback function, void *context)
+    {
+        uint32_t address;
+        return xten_elfFindSymbol(elf, name, &address) && xten_addNativeFunction(CPU, address, function, context);
+    }
+
+    /****************************************This section is for the libgcc functions**************************************************************/
+
+    static inline float xten_helper_runtimeFloat(uint32_t bits)
+    {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static inline uint32_t xten_helper_runtimeFloatBits(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static inline double xten_helper_runtimeDouble(uint64_t bits)
+    {
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static inline uint64_t xten_helper_runtimeDoubleBits(double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static inline float xten_helper_runtimeFloatArgument(Xtensa_lx_CPU *CPU, uint32_t n)
+    {
+        return xten_helper_runtimeFloat(xten_nativeArgument(CPU, n));
+    }
+
+    static inline double xten_helper_runtimeDoubleArgument(Xtensa_lx_CPU *CPU, uint32_t n)
+    {
+        return xten_helper_runtimeDouble(xten_nativeArgument64(CPU, n));
+    }
+
+    /**
+     * @brief What the libgcc comparison functions return -1 0 or 1 and unordered when either side is NaN
+     */
+    static inline uint32_t xten_helper_runtimeCompare(double first, double second, int32_t unordered)
+    {
+        if (first != first || second != second)
+        {
+            return (uint32_t)unordered;
+        }
+        return (uint32_t)((first > second) - (first < second));
+    }
+
+    /**
+     * @brief Converts to int32_t rounding toward zero saturating out of range values and NaN to the largest int
+     */
+    static inline uint32_t xten_helper_runtimeToInt(double value)
+    {
+        if (value != value || value >= 2147483648.0)
+        {
+            return 0x7FFFFFFF;
+        }
+        if (value <= -2147483649.0)
+        {
+            return 0x80000000;
+        }
+        return (uint32_t)(int32_t)value;
+    }
+
+    /**
+     * @brief Converts to uint32_t rounding toward zero negative values give 0 too large ones and NaN the largest
+     */
+    static inline uint32_t xten_helper_runtimeToUnsigned(double value)
+    {
+        if (value != value || value >= 4294967296.0)
+        {
+            return 0xFFFFFFFF;
+        }
+        if (value <= 0.0)
+        {
+            return 0;
+        }
+        return (uint32_t)value;
+    }
+
+    static inline void xten_helper_runtimeAddsf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeFloatBits(xten_helper_runtimeFloatArgument(CPU, 0) + xten_helper_runtimeFloatArgument(CPU, 1)));
+    }
+
+    static inline void xten_helper_runtimeSubsf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeFloatBits(xten_helper_runtimeFloatArgument(CPU, 0) - xten_helper_runtimeFloatArgument(CPU, 1)));
+    }
+
+    static inline void xten_helper_runtimeMulsf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeFloatBits(xten_helper_runtimeFloatArgument(CPU, 0) * xten_helper_runtimeFloatArgument(CPU, 1)));
+    }
+
+    static inline void xten_helper_runtimeDivsf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeFloatBits(xten_helper_runtimeFloatArgument(CPU, 0) / xten_helper_runtimeFloatArgument(CPU, 1)));
+    }
+
+    static inline void xten_helper_runtimeNegsf2(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_nativeArgument(CPU, 0) ^ 0x80000000);
+    }
+
+    static inline void xten_helper_runtimeAdddf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_helper_runtimeDoubleBits(xten_helper_runtimeDoubleArgument(CPU, 0) + xten_helper_runtimeDoubleArgument(CPU, 2)));
+    }
+
+    static inline void xten_helper_runtimeSubdf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_helper_runtimeDoubleBits(xten_helper_runtimeDoubleArgument(CPU, 0) - xten_helper_runtimeDoubleArgument(CPU, 2)));
+    }
+
+    static inline void xten_helper_runtimeMuldf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_helper_runtimeDoubleBits(xten_helper_runtimeDoubleArgument(CPU, 0) * xten_helper_runtimeDoubleArgument(CPU, 2)));
+    }
+
+    static inline void xten_helper_runtimeDivdf3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_helper_runtimeDoubleBits(xten_helper_runtimeDoubleArgument(CPU, 0) / xten_helper_runtimeDoubleArgument(CPU, 2)));
+    }
+
+    static inline void xten_helper_runtimeNegdf2(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_nativeArgument64(CPU, 0) ^ 0x8000000000000000ULL);
+    }
+
+    // eq ne lt and le return 1 for NaN so the caller's test against 0 fails gt and ge return -1 for the same reason
+    static inline void xten_helper_runtimeCompareFloatNanHigh(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeCompare(xten_helper_runtimeFloatArgument(CPU, 0), xten_helper_runtimeFloatArgument(CPU, 1), 1));
+    }
+
+    static inline void xten_helper_runtimeCompareFloatNanLow(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeCompare(xten_helper_runtimeFloatArgument(CPU, 0), xten_helper_runtimeFloatArgument(CPU, 1), -1));
+    }
+
+    static inline void xten_helper_runtimeCompareDoubleNanHigh(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeCompare(xten_helper_runtimeDoubleArgument(CPU, 0), xten_helper_runtimeDoubleArgument(CPU, 2), 1));
+    }
+
+    static inline void xten_helper_runtimeCompareDoubleNanLow(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeCompare(xten_helper_runtimeDoubleArgument(CPU, 0), xten_helper_runtimeDoubleArgument(CPU, 2), -1));
+    }
+
+    static inline void xten_helper_runtimeUnordsf2(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        float first = xten_helper_runtimeFloatArgument(CPU, 0);
+        float second = xten_helper_runtimeFloatArgument(CPU, 1);
+        xten_nativeReturn(CPU, first != first || second != second);
+    }
+
+    static inline void xten_helper_runtimeUnorddf2(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        double first = xten_helper_runtimeDoubleArgument(CPU, 0);
+        double second = xten_helper_runtimeDoubleArgument(CPU, 2);
+        xten_nativeReturn(CPU, first != first || second != second);
+    }
+
+    static inline void xten_helper_runtimeFixsfsi(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeToInt(xten_helper_runtimeFloatArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeFixunssfsi(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeToUnsigned(xten_helper_runtimeFloatArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeFixdfsi(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeToInt(xten_helper_runtimeDoubleArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeFixunsdfsi(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeToUnsigned(xten_helper_runtimeDoubleArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeFloatsisf(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeFloatBits((float)(int32_t)xten_nativeArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeFloatunsisf(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeFloatBits((float)xten_nativeArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeFloatsidf(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_helper_runtimeDoubleBits((double)(int32_t)xten_nativeArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeFloatunsidf(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_helper_runtimeDoubleBits((double)xten_nativeArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeExtendsfdf2(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn64(CPU, xten_helper_runtimeDoubleBits((double)xten_helper_runtimeFloatArgument(CPU, 0)));
+    }
+
+    static inline void xten_helper_runtimeTruncdfsf2(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, xten_helper_runtimeFloatBits((float)xten_helper_runtimeDoubleArgument(CPU, 0)));
+    }
+
+    // division by zero gives 0 and the one signed overflow gives the dividend instead of trapping the host
+    static inline void xten_helper_runtimeDivsi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        int32_t dividend = (int32_t)xten_nativeArgument(CPU, 0);
+        int32_t divisor = (int32_t)xten_nativeArgument(CPU, 1);
+        xten_nativeReturn(CPU, (divisor == 0) ? 0 : (divisor == -1) ? 0U - (uint32_t)dividend : (uint32_t)(dividend / divisor));
+    }
+
+    static inline void xten_helper_runtimeModsi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        int32_t dividend = (int32_t)xten_nativeArgument(CPU, 0);
+        int32_t divisor = (int32_t)xten_nativeArgument(CPU, 1);
+        xten_nativeReturn(CPU, (divisor == 0 || divisor == -1) ? 0 : (uint32_t)(dividend % divisor));
+    }
+
+    static inline void xten_helper_runtimeUdivsi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        uint32_t divisor = xten_nativeArgument(CPU, 1);
+        xten_nativeReturn(CPU, (divisor == 0) ? 0 : xten_nativeArgument(CPU, 0) / divisor);
+    }
+
+    static inline void xten_helper_runtimeUmodsi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        uint32_t divisor = xten_nativeArgument(CPU, 1);
+        xten_nativeReturn(CPU, (divisor == 0) ? 0 : xten_nativeArgument(CPU, 0) % divisor);
+    }
+
+    static inline void xten_helper_runtimeDivdi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        int64_t dividend = (int64_t)xten_nativeArgument64(CPU, 0);
+        int64_t divisor = (int64_t)xten_nativeArgument64(CPU, 2);
+        xten_nativeReturn64(CPU, (divisor == 0) ? 0 : (divisor == -1) ? 0ULL - (uint64_t)dividend : (uint64_t)(dividend / divisor));
+    }
+
+    static inline void xten_helper_runtimeModdi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        int64_t dividend = (int64_t)xten_nativeArgument64(CPU, 0);
+        int64_t divisor = (int64_t)xten_nativeArgument64(CPU, 2);
+        xten_nativeReturn64(CPU, (divisor == 0 || divisor == -1) ? 0 : (uint64_t)(dividend % divisor));
+    }
+
+    static inline void xten_helper_runtimeUdivdi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        uint64_t divisor = xten_nativeArgument64(CPU, 2);
+        xten_nativeReturn64(CPU, (divisor == 0) ? 0 : xten_nativeArgument64(CPU, 0) / divisor);
+    }
+
+    static inline void xten_helper_runtimeUmoddi3(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        uint64_t divisor = xten_nativeArgument64(CPU, 2);
+        xten_nativeReturn64(CPU, (divisor == 0) ? 0 : xten_nativeArgument64(CPU, 0) % divisor);
+    }
+
+    /****************************************This section is for the newlib functions**************************************************************/
+
+    static inline void xten_helper_runtimeMemcpy(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_moveBlock(CPU, xten_nativeArgument(CPU, 0), xten_nativeArgument(CPU, 1), xten_nativeArgument(CPU, 2));
+    }
+
+    static inline void xten_helper_runtimeMemset(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_fillBlock(CPU, xten_nativeArgument(CPU, 0), (uint8_t)xten_nativeArgument(CPU, 1), xten_nativeArgument(CPU, 2));
+    }
+
+    static inline void xten_helper_runtimeMemcmp(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        xten_nativeReturn(CPU, (uint32_t)xten_compareBlock(CPU, xten_nativeArgument(CPU, 0), xten_nativeArgument(CPU, 1), xten_nativeArgument(CPU, 2)));
+    }
+
+    static inline void xten_helper_runtimeStrlen(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        uint32_t string = xten_nativeArgument(CPU, 0);
+        uint32_t length = 0;
+        while (xten_helper_readByte(CPU, string + length) != 0)
+        {
+            length++;
+        }
+        xten_nativeReturn(CPU, length);
+    }
+
+    static inline void xten_helper_runtimeStrcmp(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        uint32_t first = xten_nativeArgument(CPU, 0);
+        uint32_t second = xten_nativeArgument(CPU, 1);
+        for (uint32_t i = 0;; i++)
+        {
+            uint8_t left = xten_helper_readByte(CPU, first + i);
+            uint8_t right = xten_helper_readByte(CPU, second + i);
+            if (left != right || left == 0)
+            {
+                xten_nativeReturn(CPU, (uint32_t)((int32_t)left - (int32_t)right));
+                return;
+            }
+        }
+    }
+
+    static inline void xten_helper_runtimeStrcpy(Xtensa_lx_CPU *CPU, void *context)
+    {
+        (void)context;
+        uint32_t destination = xten_nativeArgument(CPU, 0);
+        uint32_t source = xten_nativeArgument(CPU, 1);
+        for (uint32_t i = 0;; i++)
+        {
+            uint8_t byte = xten_helper_readByte(CPU, source + i);
+            xten_writeMemory(CPU, destination + i, byte, 1);
+            if (byte == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    /****************************************This section is for registering the replacements**************************************************************/
+
+    /**
+     * @brief Runs host code for every libgcc float and division function and newlib memory and string function in an image
+     *
+     * Functions the image does not define are skipped so calling this on any firmware is safe. Guest code calling one of
+     * them through a pointer with CALLX0 is handled too. Windowed ABI firmware calls with CALL4 and up which are not
+     * intercepted.
+     *
+     * @param *CPU Xtensa_lx_CPU pointer running the image
+     * @param *elf Xtensa_lx_ElfSymbols pointer from xten_elfLoadSymbols
+     * @return uint32_t number of functions now handled on the host
+     */
+    uint32_t xten_addRuntimeFunctions(Xtensa_lx_CPU *CPU, const Xtensa_lx_ElfSymbols *elf)
+    {
+        static const struct
+        {
+            const char *name;
+            NativeFunctionCallback function;
+        } functions[] = {
+            {"__addsf3", xten_helper_runtimeAddsf3},
+            {"__subsf3", xten_helper_runtimeSubsf3},
+            {"__mulsf3", xten_helper_runtimeMulsf3},
+            {"__divsf3", xten_helper_runtimeDivsf3},
+            {"__negsf2", xten_helper_runtimeNegsf2},
+            {"__adddf3", xten_helper_runtimeAdddf3},
+            {"__subdf3", xten_helper_runtimeSubdf3},
+            {"__muldf3", xten_helper_runtimeMuldf3},
+            {"__divdf3", xten_helper_runtimeDivdf3},
+            {"__negdf2", xten_helper_runtimeNegdf2},
+            {"__eqsf2", xten_helper_runtimeCompareFloatNanHigh},
+            {"__nesf2", xten_helper_runtimeCompareFloatNanHigh},
+            {"__ltsf2", xten_helper_runtimeCompareFloatNanHigh},
+            {"__lesf2", xten_helper_runtimeCompareFloatNanHigh},
+            {"__gtsf2", xten_helper_runtimeCompareFloatNanLow},
+            {"__gesf2", xten_helper_runtimeCompareFloatNanLow},
+            {"__unordsf2", xten_helper_runtimeUnordsf2},
+            {"__eqdf2", xten_helper_runtimeCompareDoubleNanHigh},
+            {"__nedf2", xten_helper_runtimeCompareDoubleNanHigh},
+            {"__ltdf2", xten_helper_runtimeCompareDoubleNanHigh},
+            {"__ledf2", xten_helper_runtimeCompareDoubleNanHigh},
+            {"__gtdf2", xten_helper_runtimeCompareDoubleNanLow},
+            {"__gedf2", xten_helper_runtimeCompareDoubleNanLow},
+            {"__unorddf2", xten_helper_runtimeUnorddf2},
+            {"__fixsfsi", xten_helper_runtimeFixsfsi},
+            {"__fixunssfsi", xten_helper_runtimeFixunssfsi},
+            {"__fixdfsi", xten_helper_runtimeFixdfsi},
+            {"__fixunsdfsi", xten_helper_runtimeFixunsdfsi},
+            {"__floatsisf", xten_helper_runtimeFloatsisf},
+            {"__floatunsisf", xten_helper_runtimeFloatunsisf},
+            {"__floatsidf", xten_helper_runtimeFloatsidf},
+            {"__floatunsidf", xten_helper_runtimeFloatunsidf},
+            {"__extendsfdf2", xten_helper_runtimeExtendsfdf2},
+            {"__truncdfsf2", xten_helper_runtimeTruncdfsf2},
+            {"__divsi3", xten_helper_runtimeDivsi3},
+            {"__modsi3", xten_helper_runtimeModsi3},
+            {"__udivsi3", xten_helper_runtimeUdivsi3},
+            {"__umodsi3", xten_helper_runtimeUmodsi3},
+            {"__divdi3", xten_helper_runtimeDivdi3},
+            {"__moddi3", xten_helper_runtimeModdi3},
+            {"__udivdi3", xten_helper_runtimeUdivdi3},
+            {"__umoddi3", xten_helper_runtimeUmoddi3},
+            {"memcpy", xten_helper_runtimeMemcpy},
+            {"memmove", xten_helper_runtimeMemcpy},
+            {"memset", xten_helper_runtimeMemset},
+            {"memcmp", xten_helper_runtimeMemcmp},
+            {"strlen", xten_helper_runtimeStrlen},
+            {"strcmp", xten_helper_runtimeStrcmp},
+            {"strcpy", xten_helper_runtimeStrcpy},
+        };
+        uint32_t added = 0;
+        for (size_t i = 0; i < sizeof(functions) / sizeof(functions[0]); i++)
+        {
+            added += xten_addNativeSymbol(CPU, elf, functions[i].name, functions[i].function, NULL);
+        }
+        return added;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
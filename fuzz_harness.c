@@ -0,0 +1,220 @@
+// Persistent mode fuzzing harness for firmware running on XtensaLX.h
+//
+// The firmware is booted once up to the function being fuzzed and a snapshot is taken. Every test case then restores the
+// snapshot, copies the input into a guest buffer, calls the function with a2 = buffer and a3 = length and runs until it
+// returns. Guest edge coverage is handed to libFuzzer as extra counters. Illegal instructions raise SIGILL and accesses
+// outside the mapped memory raise SIGSEGV so the fuzzer reports them as crashes.
+//
+// libFuzzer:     clang -O2 -fsanitize=fuzzer fuzz_harness.c -o xten_fuzz
+// reproduce:     gcc -O2 -DXTEN_FUZZ_STANDALONE fuzz_harness.c -o xten_fuzz_repro && ./xten_fuzz_repro crash-file
+//
+// Settings come from the environment numbers can be decimal or 0x hex:
+//   XTEN_FUZZ_IMAGE        raw firmware image loaded at the start of memory (default machine_code.m)
+//   XTEN_FUZZ_MEMORY_BASE  guest address of the start of memory (default 0x0)
+//   XTEN_FUZZ_MEMORY_SIZE  bytes of memory mapped at the base anything else faults (default 0x40000)
+//   XTEN_FUZZ_ENTRY        address execution starts at after reset (default the memory base)
+//   XTEN_FUZZ_TARGET       function test cases are passed to execution boots to here first (default the entry)
+//   XTEN_FUZZ_BUFFER       guest address test cases are copied to (default just below the return address)
+//   XTEN_FUZZ_BUFFER_SIZE  longest test case the rest is cut off (default 0x1000)
+//   XTEN_FUZZ_RETURN       return address put in a0 reaching it ends the test case (default the last word of memory)
+//   XTEN_FUZZ_LIMIT        most instructions per test case (default 1000000)
+//   XTEN_FUZZ_BOOT_LIMIT   most instructions to reach the target (default 100000000)
+
+#define XTEN_NO_DEBUGGING
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "XtensaLX.h"
+
+#define XTEN_FUZZ_COVERAGE_SIZE 65536
+#define XTEN_FUZZ_DEFAULT_IMAGE "machine_code.m"
+#define XTEN_FUZZ_DEFAULT_MEMORY_SIZE 0x40000
+#define XTEN_FUZZ_DEFAULT_BUFFER_SIZE 0x1000
+#define XTEN_FUZZ_DEFAULT_LIMIT 1000000
+#define XTEN_FUZZ_DEFAULT_BOOT_LIMIT 100000000
+
+// libFuzzer picks up counters placed in this section on top of the coverage of the harness itself
+#if defined(__linux__)
+__attribute__((section("__libfuzzer_extra_counters")))
+#endif
+static uint8_t fuzzCoverage[XTEN_FUZZ_COVERAGE_SIZE];
+
+typedef struct FuzzTarget
+{
+   Xtensa_lx_CPU *CPU;
+   Xtensa_lx_Snapshot *snapshot;
+   uint8_t *memory;
+   uint32_t memoryBase;
+   uint32_t memorySize;
+   uint32_t target;
+   uint32_t buffer;
+   uint32_t bufferSize;
+   uint32_t returnAddress;
+   uint32_t limit;
+} FuzzTarget;
+
+static FuzzTarget fuzz;
+
+static uint32_t fuzzSetting(const char *name, uint32_t defaultValue)
+{
+   const char *value = getenv(name);
+   return (value == NULL || *value == '\0') ? defaultValue : (uint32_t)strtoul(value, NULL, 0);
+}
+
+// everything outside the mapped memory ends up here and is treated as an access to memory that does not exist
+static uint32_t fuzzReadMemory(Xtensa_lx_CPU *CPU, uint32_t address, void *context)
+{
+   (void)context;
+   xten_raiseMemoryFault(CPU, address);
+   return 0;
+}
+
+static void fuzzWriteMemory(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes, void *context)
+{
+   (void)value;
+   (void)numBytes;
+   (void)context;
+   xten_raiseMemoryFault(CPU, address);
+}
+
+static void fuzzFail(const char *message)
+{
+   fprintf(stderr, "fuzz harness: %s\n", message);
+   exit(1);
+}
+
+static void fuzzSetup(void)
+{
+   fuzz.memoryBase = fuzzSetting("XTEN_FUZZ_MEMORY_BASE", 0x0) & ~(XTEN_PAGE_SIZE - 1);
+   fuzz.memorySize = (fuzzSetting("XTEN_FUZZ_MEMORY_SIZE", XTEN_FUZZ_DEFAULT_MEMORY_SIZE) + XTEN_PAGE_SIZE - 1) & ~(XTEN_PAGE_SIZE - 1);
+   uint32_t entry = fuzzSetting("XTEN_FUZZ_ENTRY", fuzz.memoryBase);
+   fuzz.target = fuzzSetting("XTEN_FUZZ_TARGET", entry);
+   fuzz.returnAddress = fuzzSetting("XTEN_FUZZ_RETURN", fuzz.memoryBase + fuzz.memorySize - 4);
+   fuzz.bufferSize = fuzzSetting("XTEN_FUZZ_BUFFER_SIZE", XTEN_FUZZ_DEFAULT_BUFFER_SIZE);
+   fuzz.buffer = fuzzSetting("XTEN_FUZZ_BUFFER", (fuzz.returnAddress & ~0xFU) - fuzz.bufferSize);
+   fuzz.limit = fuzzSetting("XTEN_FUZZ_LIMIT", XTEN_FUZZ_DEFAULT_LIMIT);
+   uint32_t bootLimit = fuzzSetting("XTEN_FUZZ_BOOT_LIMIT", XTEN_FUZZ_DEFAULT_BOOT_LIMIT);
+   const char *image = getenv("XTEN_FUZZ_IMAGE");
+   if (image == NULL || *image == '\0')
+   {
+      image = XTEN_FUZZ_DEFAULT_IMAGE;
+   }
+
+   fuzz.memory = (uint8_t *)calloc(1, fuzz.memorySize);
+   if (fuzz.memory == NULL || fuzz.memorySize == 0)
+   {
+      fuzzFail("could not allocate guest memory");
+   }
+   FILE *imageFile = fopen(image, "rb");
+   if (imageFile == NULL)
+   {
+      fuzzFail("could not open the firmware image");
+   }
+   size_t imageSize = fread(fuzz.memory, 1, fuzz.memorySize, imageFile);
+   fclose(imageFile);
+   if (imageSize == 0)
+   {
+      fuzzFail("could not read the firmware image");
+   }
+
+   fuzz.CPU = xten_createCPU(fuzzReadMemory, fuzzWriteMemory, &fuzz);
+   if (fuzz.CPU == NULL || !xten_mapMemory(fuzz.CPU, fuzz.memoryBase, fuzz.memorySize, fuzz.memory, XTEN_PAGE_READ | XTEN_PAGE_WRITE))
+   {
+      fuzzFail("could not create the CPU");
+   }
+
+   // boot up to the target so the snapshot holds whatever initialization the firmware does first
+   fuzz.CPU->PC = entry;
+   fuzz.CPU->addressLines = entry;
+   xten_addBreakpoint(fuzz.CPU, fuzz.target);
+   while (fuzz.CPU->PC != fuzz.target && bootLimit > 0)
+   {
+      bootLimit -= xten_run(fuzz.CPU, bootLimit);
+      if (fuzz.CPU->stopReason == XTEN_STOP_ILLEGAL_INSTRUCTION || fuzz.CPU->stopReason == XTEN_STOP_MEMORY_FAULT ||
+          fuzz.CPU->chipEnable != XTEN_HIGH)
+      {
+         break;
+      }
+   }
+   xten_removeBreakpoint(fuzz.CPU, fuzz.target);
+   if (fuzz.CPU->PC != fuzz.target)
+   {
+      fuzzFail("the firmware never reached XTEN_FUZZ_TARGET");
+   }
+
+   xten_addBreakpoint(fuzz.CPU, fuzz.returnAddress);
+   xten_enableCoverage(fuzz.CPU, fuzzCoverage, sizeof(fuzzCoverage));
+   fuzz.snapshot = xten_takeSnapshot(fuzz.CPU);
+   if (fuzz.snapshot == NULL)
+   {
+      fuzzFail("could not take a snapshot");
+   }
+}
+
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+   (void)argc;
+   (void)argv;
+   fuzzSetup();
+   return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+   if (fuzz.snapshot == NULL)
+   {
+      fuzzSetup(); // drivers that never call LLVMFuzzerInitialize
+   }
+   Xtensa_lx_CPU *CPU = fuzz.CPU;
+   xten_restoreSnapshot(fuzz.snapshot);
+
+   uint32_t length = (size > fuzz.bufferSize) ? fuzz.bufferSize : (uint32_t)size;
+   for (uint32_t i = 0; i < length; i++)
+   {
+      xten_writeMemory(CPU, fuzz.buffer + i, data[i], 1);
+   }
+   CPU->registerFile[CPU->windowOffset + 0] = fuzz.returnAddress;
+   CPU->registerFile[CPU->windowOffset + 2] = fuzz.buffer;
+   CPU->registerFile[CPU->windowOffset + 3] = length;
+
+   uint32_t remaining = fuzz.limit;
+   while (remaining > 0 && CPU->PC != fuzz.returnAddress && CPU->chipEnable == XTEN_HIGH)
+   {
+      remaining -= xten_run(CPU, remaining);
+      if (CPU->stopReason == XTEN_STOP_ILLEGAL_INSTRUCTION)
+      {
+         fprintf(stderr, "fuzz harness: illegal instruction at %08X\n", CPU->epc1);
+         raise(SIGILL);
+      }
+      if (CPU->stopReason == XTEN_STOP_MEMORY_FAULT)
+      {
+         fprintf(stderr, "fuzz harness: access to unmapped address %08X at %08X\n", CPU->excvaddr, CPU->epc1);
+         raise(SIGSEGV);
+      }
+   }
+   return 0;
+}
+
+#ifdef XTEN_FUZZ_STANDALONE
+int main(int argc, char *argv[])
+{
+   LLVMFuzzerInitialize(&argc, &argv);
+   for (int i = 1; i < argc; i++)
+   {
+      FILE *input = fopen(argv[i], "rb");
+      if (input == NULL)
+      {
+         fprintf(stderr, "could not open %s\n", argv[i]);
+         continue;
+      }
+      uint8_t *data = (uint8_t *)malloc(fuzz.bufferSize + 1);
+      size_t size = (data == NULL) ? 0 : fread(data, 1, fuzz.bufferSize, input);
+      fclose(input);
+      LLVMFuzzerTestOneInput(data, size);
+      printf("%s: returned after %u instructions\n", argv[i], fuzz.CPU->ccount - fuzz.snapshot->ccount);
+      free(data);
+   }
+   return 0;
+}
+#endif
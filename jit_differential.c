@@ -0,0 +1,359 @@
+// Differential test of the XTEN_ENABLE_JIT translator against the interpreter
+//
+// Every program is loaded into two CPUs. One runs it with xten_run so hot blocks go through the JIT and the other runs the
+// same number of instructions one xten_step at a time. The registers, PC, CCOUNT, SAR, stop reason and memory have to match
+// after every chunk. The programs are the checked in .m test programs followed by generated blocks of ALU, shift, L32R,
+// load, store, branch, call and RET instructions in both byte orders whose jumps, calls and returns all land on generated
+// instructions. Reads outside the mapped memory return a pattern based on the address and writes there are dropped so both
+// CPUs see the same thing.
+//
+// build and run from the repository root (x86-64 only):
+//                gcc -O2 jit_differential.c -o xten_jit_diff && ./xten_jit_diff
+//
+// Exits with 1 and prints the first few mismatches when the two CPUs disagree or when the generated programs stop so early
+// on average that they barely reach the JIT. XTEN_DIFF_SEED and XTEN_DIFF_PROGRAMS in the environment change the seed and
+// the number of generated programs (decimal or 0x hex).
+
+#define XTEN_NO_DEBUGGING
+#define XTEN_ENABLE_JIT
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "XtensaLX.h"
+
+#define XTEN_DIFF_MEMORY_SIZE 0x10000
+#define XTEN_DIFF_CODE_SIZE 0xF000      // generated code goes below this and data above it
+#define XTEN_DIFF_INSTRUCTIONS 4000     // instructions each program runs for
+#define XTEN_DIFF_DEFAULT_PROGRAMS 2000 // generated programs
+#define XTEN_DIFF_REPORTS 5             // mismatches printed before only counting them
+#define XTEN_DIFF_MIN_AVERAGE 2000      // generated programs stopping sooner than this on average are not testing much
+
+static const char *diffTestPrograms[] = {
+    "core_load_instruction_test.m",
+    "core_store_instruction_test.m",
+    "core_memoryOrdering_instruction_test.m",
+    "increment_zero_test.m",
+    "load_test.m",
+    "machine_code.m",
+};
+
+typedef struct DiffRun
+{
+   uint8_t *jitMemory;
+   uint8_t *stepMemory;
+   uint32_t seed;
+   unsigned long programs;
+   unsigned long instructions;
+   unsigned long mismatches;
+} DiffRun;
+
+static DiffRun diff;
+
+static uint32_t diffSetting(const char *name, uint32_t defaultValue)
+{
+   const char *value = getenv(name);
+   return (value == NULL || *value == '\0') ? defaultValue : (uint32_t)strtoul(value, NULL, 0);
+}
+
+uint32_t diffReadMemory(Xtensa_lx_CPU *CPU, uint32_t address, void *context)
+{
+   (void)CPU;
+   (void)context;
+   return address * 2654435761u;
+}
+
+void diffWriteMemory(Xtensa_lx_CPU *CPU, uint32_t address, uint32_t value, int numBytes, void *context)
+{
+   (void)CPU;
+   (void)address;
+   (void)value;
+   (void)numBytes;
+   (void)context;
+}
+
+static uint32_t diffRandom(void)
+{
+   diff.seed ^= diff.seed << 13;
+   diff.seed ^= diff.seed >> 17;
+   diff.seed ^= diff.seed << 5;
+   return diff.seed;
+}
+
+// RRR format op0 in the top nibble for big-endian and the bottom one for little-endian with every other field following
+static uint32_t diffRRR(bool msbFirst, uint32_t op0, uint32_t op1, uint32_t op2, uint32_t r, uint32_t s, uint32_t t)
+{
+   return msbFirst ? (op0 << 20) | (t << 16) | (s << 12) | (r << 8) | (op1 << 4) | op2
+                   : (op2 << 20) | (op1 << 16) | (r << 12) | (s << 8) | (t << 4) | op0;
+}
+
+// RRI8 format the 8 bit immediate is the bottom byte for big-endian and the top one for little-endian
+static uint32_t diffRRI8(bool msbFirst, uint32_t op0, uint32_t r, uint32_t s, uint32_t t, uint32_t imm8)
+{
+   return msbFirst ? (op0 << 20) | (t << 16) | (s << 12) | (r << 8) | imm8 : (imm8 << 16) | (r << 12) | (s << 8) | (t << 4) | op0;
+}
+
+// CALL format with n zero so CALL0 or J with the 18 bit offset filling the rest
+static uint32_t diffCall(bool msbFirst, uint32_t op0, uint32_t offset)
+{
+   return msbFirst ? (op0 << 20) | (offset & 0x3FFFF) : ((offset & 0x3FFFF) << 6) | op0;
+}
+
+// CALLX format the m and n fields share the t nibble in opposite halves for the two byte orders
+static uint32_t diffCallX(bool msbFirst, uint32_t m, uint32_t n, uint32_t s)
+{
+   return diffRRR(msbFirst, 0x0, 0x0, 0x0, 0x0, s, msbFirst ? (n << 2) | m : (m << 2) | n);
+}
+
+// picks an address in the code area close to pc that is a multiple of step
+static uint32_t diffTarget(uint32_t pc, uint32_t step)
+{
+   int32_t target = (int32_t)pc + (int32_t)(diffRandom() % 0x800) - 0x400;
+   target = (target < 0) ? 0 : (target >= XTEN_DIFF_CODE_SIZE) ? XTEN_DIFF_CODE_SIZE - 1 : target;
+   return (uint32_t)target / step * step;
+}
+
+// returns the instruction placed at pc every generated control transfer lands on an instruction in the code area and only
+// a1 to a11 are written so a12 and a13 keep code addresses and a14 and a15 keep data addresses
+static uint32_t diffInstruction(uint32_t pc, bool msbFirst)
+{
+   static const uint32_t loadsStores[] = {0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x9};
+   uint32_t r = 1 + diffRandom() % 11;
+   uint32_t s = diffRandom() & 0xF;
+   uint32_t t = diffRandom() & 0xF;
+   if (diffRandom() % 1024 == 0)
+   {
+      return diffRandom() & 0xFFFFFF; // anything at all now and then to end blocks on illegal instructions
+   }
+   switch (diffRandom() % 15)
+   {
+   case 0: // ADD ADDX2 ADDX4 ADDX8 SUB SUBX2 SUBX4 SUBX8
+      return diffRRR(msbFirst, 0x0, 0x0, 0x8 + (diffRandom() & 0x7), r, s, t);
+   case 1: // AND OR XOR
+      return diffRRR(msbFirst, 0x0, 0x0, 0x1 + diffRandom() % 3, r, s, t);
+   case 2: // NEG ABS
+      return diffRRR(msbFirst, 0x0, 0x0, 0x6, r, diffRandom() & 1, t);
+   case 3: // MOVI ADDI
+      return diffRRI8(msbFirst, 0x2, (diffRandom() & 1) ? 0xA : 0xC, s, r, diffRandom() & 0xFF);
+   case 4: // SRC SRL SLL SRA or WSR.SAR to give them a new shift amount the sr field is r then s or s then r
+      return (diffRandom() & 3) ? diffRRR(msbFirst, 0x0, 0x1, 0x8 + (diffRandom() & 0x3), r, s, t)
+                                : diffRRR(msbFirst, 0x0, 0x3, 0x1, msbFirst ? SAR_NUM : 0x0, msbFirst ? 0x0 : SAR_NUM, t);
+   case 5: // EXTUI
+      return diffRRR(msbFirst, 0x0, 0x4 | (diffRandom() & 1), diffRandom() & 0xF, r, s, t);
+   case 6: // MOVEQZ MOVNEZ MOVLTZ MOVGEZ
+      return diffRRR(msbFirst, 0x0, 0x3, 0x8 + (diffRandom() & 0x3), r, s, t);
+   case 7: // L32R from up to 4KB back
+   {
+      uint32_t imm16 = 0x10000 - 1 - (diffRandom() % 0x400);
+      return msbFirst ? (0x1 << 20) | (r << 16) | imm16 : (imm16 << 8) | (r << 4) | 0x1;
+   }
+   case 8: // loads and stores off a12 to a15 with stores mostly into the data area
+   {
+      uint32_t op = loadsStores[diffRandom() % 7];
+      bool store = (op & 0x4) != 0;
+      uint32_t base = 12 + ((store && (diffRandom() & 7)) ? 2 : 0) + (diffRandom() & 1);
+      return diffRRI8(msbFirst, 0x2, op, base, store ? t : r, diffRandom() & 0xFF);
+   }
+   case 9:
+   case 10: // BNONE..BBSI the offset is in multiples of four so one that is a multiple of three keeps the target on an instruction
+   {
+      int32_t steps = (int32_t)(diffRandom() % 85) - 42;
+      int32_t target = (int32_t)pc + 12 * steps;
+      steps = (target < 0 || target >= XTEN_DIFF_CODE_SIZE) ? -steps : steps;
+      uint32_t offset = (uint32_t)(3 * steps) & 0xFF;
+      uint32_t branch = diffRRI8(msbFirst, 0x7, diffRandom() & 0xF, s, t, msbFirst ? offset : 0);
+      // the little-endian offset is read from bits 6 to 13 so it shares them with t s and r
+      return msbFirst ? branch : (branch & ~(0xFFu << 6)) | (offset << 6);
+   }
+   case 11: // CALL0 the target is the word aligned PC plus four times the offset so it has to be a multiple of twelve
+      return diffCall(msbFirst, 0x5, (uint32_t)(((int32_t)diffTarget(pc, 12) - (int32_t)(pc & ~3u)) / 4));
+   case 12: // J the offset is in bytes
+      return diffCall(msbFirst, 0x6, diffTarget(pc, 3) - pc);
+   case 13: // CALLX0 JX through the code addresses in a12 and a13
+      return (diffRandom() & 1) ? diffCallX(msbFirst, 0x3, 0x0, 12 + (diffRandom() & 1))
+                                : diffCallX(msbFirst, 0x2, 0x2, 12 + (diffRandom() & 1));
+   default: // RET
+      return diffCallX(msbFirst, 0x2, 0x0, 0x0);
+   }
+}
+
+static Xtensa_lx_CPU *diffCreateCPU(uint8_t *memory, bool msbFirst)
+{
+   Xtensa_lx_CPU *CPU = xten_createCPU(diffReadMemory, diffWriteMemory, &diff);
+   if (CPU == NULL || !xten_mapMemory(CPU, 0, XTEN_DIFF_MEMORY_SIZE, memory, XTEN_PAGE_READ | XTEN_PAGE_WRITE))
+   {
+      fprintf(stderr, "jit differential: could not create a CPU\n");
+      exit(1);
+   }
+   xten_ops_setMSBFirst(CPU, msbFirst);
+   return CPU;
+}
+
+static bool diffSame(Xtensa_lx_CPU *jit, Xtensa_lx_CPU *step)
+{
+   return jit->PC == step->PC && jit->ccount == step->ccount && jit->sar == step->sar && jit->stopReason == step->stopReason &&
+          memcmp(jit->registerFile, step->registerFile, 16 * sizeof(uint32_t)) == 0 &&
+          memcmp(diff.jitMemory, diff.stepMemory, XTEN_DIFF_MEMORY_SIZE) == 0;
+}
+
+static void diffReport(const char *name, Xtensa_lx_CPU *jit, Xtensa_lx_CPU *step, uint32_t start)
+{
+   if (diff.mismatches++ >= XTEN_DIFF_REPORTS)
+   {
+      return;
+   }
+   printf("%s started at %08X: PC %08X/%08X CCOUNT %u/%u SAR %u/%u stop %d/%d\n", name, start, jit->PC, step->PC, jit->ccount,
+          step->ccount, jit->sar, step->sar, jit->stopReason, step->stopReason);
+   for (int i = 0; i < 16; i++)
+   {
+      if (jit->registerFile[i] != step->registerFile[i])
+      {
+         printf("  a%d %08X/%08X\n", i, jit->registerFile[i], step->registerFile[i]);
+      }
+   }
+   if (memcmp(diff.jitMemory, diff.stepMemory, XTEN_DIFF_MEMORY_SIZE) != 0)
+   {
+      printf("  memory differs\n");
+   }
+}
+
+// runs what is in diff.jitMemory from start with both CPUs in chunks of varying size comparing them after every chunk
+static void diffRunProgram(const char *name, bool msbFirst, uint32_t start, const uint32_t registers[16], uint32_t sar)
+{
+   memcpy(diff.stepMemory, diff.jitMemory, XTEN_DIFF_MEMORY_SIZE);
+   Xtensa_lx_CPU *jit = diffCreateCPU(diff.jitMemory, msbFirst);
+   Xtensa_lx_CPU *step = diffCreateCPU(diff.stepMemory, msbFirst);
+   memcpy(jit->registerFile, registers, 16 * sizeof(uint32_t));
+   memcpy(step->registerFile, registers, 16 * sizeof(uint32_t));
+   jit->sar = step->sar = sar;
+   jit->PC = step->PC = start;
+   jit->addressLines = step->addressLines = start;
+
+   uint32_t remaining = XTEN_DIFF_INSTRUCTIONS;
+   while (remaining > 0)
+   {
+      uint32_t chunk = 1 + diffRandom() % 1000;
+      chunk = (chunk > remaining) ? remaining : chunk;
+      uint32_t ran = xten_run(jit, chunk);
+      uint32_t stepped = 0;
+      while (stepped < ran && step->chipEnable == XTEN_HIGH)
+      {
+         xten_step(step);
+         stepped++;
+         if (step->stopReason != XTEN_STOP_NONE)
+         {
+            break;
+         }
+      }
+      diff.instructions += ran;
+      if (stepped != ran || !diffSame(jit, step))
+      {
+         diffReport(name, jit, step, start);
+         break;
+      }
+      // a stop ends the program since neither CPU takes exceptions
+      if (ran < chunk || jit->stopReason != XTEN_STOP_NONE)
+      {
+         break;
+      }
+      remaining -= ran;
+   }
+   diff.programs++;
+   xten_freeCPU(jit);
+   xten_freeCPU(step);
+}
+
+static void diffTestProgram(const char *path)
+{
+   FILE *file = fopen(path, "rb");
+   if (file == NULL)
+   {
+      fprintf(stderr, "jit differential: could not open %s run from the repository root\n", path);
+      exit(1);
+   }
+   memset(diff.jitMemory, 0, XTEN_DIFF_MEMORY_SIZE);
+   size_t size = fread(diff.jitMemory, 1, XTEN_DIFF_MEMORY_SIZE, file);
+   fclose(file);
+   if (size == 0)
+   {
+      fprintf(stderr, "jit differential: could not read %s\n", path);
+      exit(1);
+   }
+   uint32_t registers[16] = {0};
+   diffRunProgram(path, true, 0, registers, 0);
+}
+
+static void diffGeneratedProgram(bool msbFirst)
+{
+   for (uint32_t pc = 0; pc + 3 <= XTEN_DIFF_CODE_SIZE; pc += 3)
+   {
+      uint32_t opcode = diffInstruction(pc, msbFirst);
+      diff.jitMemory[pc] = (uint8_t)(opcode >> 16);
+      diff.jitMemory[pc + 1] = (uint8_t)(opcode >> 8);
+      diff.jitMemory[pc + 2] = (uint8_t)opcode;
+   }
+   for (uint32_t i = XTEN_DIFF_CODE_SIZE; i < XTEN_DIFF_MEMORY_SIZE; i++)
+   {
+      diff.jitMemory[i] = (uint8_t)diffRandom();
+   }
+   // a0 is a return address a12 and a13 are jump targets and a14 and a15 are word aligned data addresses far enough below
+   // the end of memory for the largest load offset the rest hold whatever
+   uint32_t registers[16];
+   registers[0] = (diffRandom() % (XTEN_DIFF_CODE_SIZE / 3)) * 3;
+   for (int i = 1; i < 12; i++)
+   {
+      switch (diffRandom() % 3)
+      {
+      case 0:
+         registers[i] = diffRandom() & 0x1F;
+         break;
+      case 1:
+         registers[i] = XTEN_DIFF_CODE_SIZE + (diffRandom() % 0x300) * 4;
+         break;
+      default:
+         registers[i] = diffRandom();
+         break;
+      }
+   }
+   registers[12] = (diffRandom() % (XTEN_DIFF_CODE_SIZE / 3)) * 3;
+   registers[13] = (diffRandom() % (XTEN_DIFF_CODE_SIZE / 12)) * 12;
+   registers[14] = XTEN_DIFF_CODE_SIZE + (diffRandom() % 0x300) * 4;
+   registers[15] = XTEN_DIFF_CODE_SIZE + (diffRandom() % 0x300) * 4;
+   uint32_t start = (diffRandom() % (XTEN_DIFF_CODE_SIZE / 3)) * 3;
+   diffRunProgram(msbFirst ? "generated big-endian" : "generated little-endian", msbFirst, start, registers, diffRandom() % 40);
+}
+
+int main(void)
+{
+   diff.seed = diffSetting("XTEN_DIFF_SEED", 1);
+   diff.seed = (diff.seed == 0) ? 1 : diff.seed;
+   uint32_t generated = diffSetting("XTEN_DIFF_PROGRAMS", XTEN_DIFF_DEFAULT_PROGRAMS);
+   diff.jitMemory = (uint8_t *)malloc(XTEN_DIFF_MEMORY_SIZE);
+   diff.stepMemory = (uint8_t *)malloc(XTEN_DIFF_MEMORY_SIZE);
+   if (diff.jitMemory == NULL || diff.stepMemory == NULL)
+   {
+      fprintf(stderr, "jit differential: could not allocate guest memory\n");
+      return 1;
+   }
+
+   for (size_t i = 0; i < sizeof(diffTestPrograms) / sizeof(diffTestPrograms[0]); i++)
+   {
+      diffTestProgram(diffTestPrograms[i]);
+   }
+   unsigned long testInstructions = diff.instructions;
+   for (uint32_t i = 0; i < generated; i++)
+   {
+      diffGeneratedProgram((i & 1) == 0);
+   }
+   unsigned long average = (generated == 0) ? 0 : (diff.instructions - testInstructions) / generated;
+
+   printf("%lu programs %lu instructions %lu mismatches\n", diff.programs, diff.instructions, diff.mismatches);
+   printf("generated programs ran %lu instructions on average\n", average);
+   free(diff.jitMemory);
+   free(diff.stepMemory);
+   if (generated != 0 && average < XTEN_DIFF_MIN_AVERAGE)
+   {
+      fprintf(stderr, "jit differential: generated programs stop too early to test the JIT\n");
+      return 1;
+   }
+   return (diff.mismatches == 0) ? 0 : 1;
+}